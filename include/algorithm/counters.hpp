@@ -0,0 +1,64 @@
+/** Operation counters for instrumenting the algorithms.
+ *
+ * The counting macros only do something when the code is compiled with
+ * `ALGORITHMS_STUDY_COUNT_OPERATIONS` defined (the benchmark target does this
+ * when the `BENCHMARK_COUNT_OPERATIONS` CMake option is on). Otherwise they
+ * expand to nothing, so normal builds pay nothing for them.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_COUNTERS_HPP
+#define ALGORITHMS_STUDY_CPP_COUNTERS_HPP
+
+#include <atomic>
+
+
+/** Totals of the basic operations performed by the algorithms.
+ */
+struct OperationCounts {
+    unsigned long long comparisons; ///< Comparisons between two items.
+    unsigned long long swaps;       ///< Exchanges of two items.
+    unsigned long long moves;       ///< Other writes of a single item.
+};
+
+/** Return whether this build actually counts operations.
+ *
+ * @return  True if compiled with `ALGORITHMS_STUDY_COUNT_OPERATIONS`.
+ */
+bool OperationCountingEnabled();
+
+/** Return the operations counted since the last reset.
+ *
+ * All counts are zero if operation counting is not enabled.
+ *
+ * @return  Operation totals.
+ */
+OperationCounts GetOperationCounts();
+
+/** Set all operation counts back to zero.
+ */
+void ResetOperationCounts();
+
+#ifdef ALGORITHMS_STUDY_COUNT_OPERATIONS
+
+// Atomic so the parallel algorithms can share them; this is only ever compiled
+// into instrumented builds, whose timings are not meant to be taken seriously.
+extern std::atomic<unsigned long long> comparison_count;
+extern std::atomic<unsigned long long> swap_count;
+extern std::atomic<unsigned long long> move_count;
+
+#define COUNT_COMPARISONS(n) \
+    ((void)comparison_count.fetch_add((n), std::memory_order_relaxed))
+#define COUNT_SWAPS(n) \
+    ((void)swap_count.fetch_add((n), std::memory_order_relaxed))
+#define COUNT_MOVES(n) \
+    ((void)move_count.fetch_add((n), std::memory_order_relaxed))
+
+#else
+
+#define COUNT_COMPARISONS(n) ((void)0)
+#define COUNT_SWAPS(n) ((void)0)
+#define COUNT_MOVES(n) ((void)0)
+
+#endif
+
+#endif //ALGORITHMS_STUDY_CPP_COUNTERS_HPP
@@ -0,0 +1,68 @@
+/** External-memory merge sort, for files of keys larger than memory.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_EXTERNAL_SORT_HPP
+#define ALGORITHMS_STUDY_CPP_EXTERNAL_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+/** Tuning knobs of `ExternalSort`.
+ */
+struct ExternalSortOptions {
+    /// Memory for data buffers, in bytes. Runs are half of it, so each of the
+    /// two chunk buffers can be filled while the other is sorted.
+    std::size_t memory_bytes;
+    /// Bytes per read or write while merging (rounded up to 4 KiB). Bigger
+    /// blocks mean fewer seeks between the runs, but fewer runs per merge.
+    std::size_t block_bytes;
+    /// Most runs merged at once; 0 means as many as memory allows.
+    int max_fan_in;
+    /// Bypass the page cache with O_DIRECT, where supported.
+    bool direct_io;
+    /// Path prefix of the temporary run files; empty means the output path.
+    std::string temp_prefix;
+
+    ExternalSortOptions()
+        : memory_bytes((std::size_t)1 << 30), block_bytes(8 << 20),
+          max_fan_in(0), direct_io(false) {}
+};
+
+/** What `ExternalSort` did.
+ */
+struct ExternalSortStats {
+    std::uint64_t num_keys;     ///< Keys sorted.
+    int num_runs;               ///< Sorted runs the input was split into.
+    int merge_passes;           ///< Passes over the data merging runs.
+};
+
+/** Sort a binary file of int64 keys (native byte order) into another file.
+ *
+ * 1. The input is streamed in chunks of half the memory budget; each chunk is
+ *    sorted in memory (`AmericanFlagSort`, the fastest sort here for 64-bit
+ *    keys) and spilled to a temporary run file, while the next chunk is read
+ *    in the background.
+ * 2. The runs are merged with a `LoserTree`, as many at a time as the memory
+ *    budget allows (each run gets two blocks, so one can be read ahead while
+ *    the other is merged), until the last pass writes the output.
+ *
+ * If the input fits in one chunk it is sorted in memory and written out
+ * directly. Temporary files are removed, even when an error is thrown.
+ *
+ * Worst-case performance: Theta(n lg n) time, Theta(n / B log_k (n / M))
+ * I/Os, for B-key blocks, k-way merges and M keys of memory
+ *
+ * @param input_path    File to be sorted; its size must be a multiple of 8.
+ * @param output_path   File to write the sorted keys to (must not be the
+ *      input).
+ * @param options       Memory budget, block size, etc.
+ * @return              Statistics of the sort.
+ * @throws std::runtime_error   On I/O errors or a malformed input.
+ */
+ExternalSortStats ExternalSort(
+    const std::string &input_path, const std::string &output_path,
+    const ExternalSortOptions &options = ExternalSortOptions());
+
+#endif //ALGORITHMS_STUDY_CPP_EXTERNAL_SORT_HPP
@@ -0,0 +1,120 @@
+/** A work-stealing thread pool for fork-join parallel algorithms.
+ *
+ * Each worker thread owns a deque of tasks: it pushes and pops its own tasks at
+ * the back (so the most recently forked, cache-warm task runs first) and, when
+ * it runs out, steals the oldest task from the front of another worker's deque
+ * (which tends to be the biggest piece of remaining work). Tasks submitted from
+ * outside the pool go to a shared queue that every worker also takes from.
+ *
+ * Fork-join code uses a `TaskGroup`: `Run()` forks a task, and `Wait()` joins
+ * them, running pending tasks on the waiting thread in the meantime. So waiting
+ * never blocks a worker, and the thread that started the work counts as one of
+ * the pool's threads.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_THREAD_POOL_HPP
+#define ALGORITHMS_STUDY_CPP_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/** Return the number of threads to use when the caller asked for 0 ("all").
+ *
+ * @param num_threads   Requested number of threads; 0 means one per core.
+ * @return              Number of threads to use (at least 1).
+ */
+int ResolveThreadCount(const int num_threads);
+
+/** A fixed-size pool of worker threads with work stealing.
+ */
+class ThreadPool {
+public:
+    /** Start the pool.
+     *
+     * @param num_threads   Total threads working on the pool's tasks,
+     *      including the thread waiting on them; `num_threads - 1` background
+     *      workers are started. 0 means one thread per core.
+     */
+    explicit ThreadPool(const int num_threads = 0);
+
+    /** Finish all queued tasks, then stop the workers. */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /** Number of threads working on the pool's tasks (including the waiter). */
+    int NumThreads() const { return (int)workers_.size(); }
+
+    /** Queue a task to be run by some thread of the pool.
+     *
+     * Called from a worker, the task goes on that worker's own deque;
+     * otherwise it goes on the shared queue.
+     */
+    void Submit(std::function<void()> task);
+
+    /** Run one queued task on the calling thread, if there is one.
+     *
+     * @return  True if a task was run.
+     */
+    bool RunPendingTask();
+
+private:
+    /** One thread's task deque. The lock is only contended by thieves. */
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void WorkerLoop(const int index);
+    bool PopTask(const int index, std::function<void()> &task);
+
+    // Index 0 is the shared queue (used by threads outside the pool); the
+    // background workers own queues 1 to NumThreads() - 1.
+    std::vector<std::unique_ptr<TaskQueue>> workers_;
+    std::vector<std::thread> threads_;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_up_;
+    std::atomic<long long> queued_tasks_;
+    bool stopping_;
+};
+
+/** A set of forked tasks that can be waited on together.
+ *
+ * If a task throws, `Wait()` rethrows the first exception after all the
+ * group's tasks have finished.
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool &pool);
+
+    /** Wait for any tasks still running. */
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    /** Fork a task onto the pool. */
+    void Run(std::function<void()> task);
+
+    /** Join: help run pending tasks until all of this group's tasks are done.
+     */
+    void Wait();
+
+private:
+    ThreadPool &pool_;
+    std::atomic<long long> pending_;
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;
+};
+
+#endif //ALGORITHMS_STUDY_CPP_THREAD_POOL_HPP
@@ -6,6 +6,10 @@
 #ifndef ALGORITHMS_STUDY_CPP_RANDOM_HPP
 #define ALGORITHMS_STUDY_CPP_RANDOM_HPP
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #include "algorithm/matrix/matrix.hpp"
 
 
@@ -79,11 +83,41 @@ void RandomlyFillMatrix(
  */
 void RandomlyPermute(std::vector<int> &vec);
 
+/** Randomly sample items of the range, without replacement.
+ *
+ * Uses Floyd's algorithm, so every set of `num_samples` distinct positions is
+ * equally likely to be picked, and the range isn't modified.
+ *
+ * Worst-case performance: O(num_samples^2)
+ *
+ * @param first         Iterator to the first item to be sampled from.
+ * @param last          Iterator after the last item to be sampled from.
+ * @param num_samples   Number of items to sample; at most `last - first`.
+ * @return              Vector containing the sampled items.
+ */
+template <typename RandomIt>
+std::vector<typename std::iterator_traits<RandomIt>::value_type> RandomlySample(
+        RandomIt first, RandomIt last, const int num_samples) {
+    std::vector<int> sample_indices;
+    std::vector<typename std::iterator_traits<RandomIt>::value_type> samples;
+    for (int i = 0; i < num_samples; ++i) {
+        int sample_range = (int)(last - first) - num_samples + i;
+        int index = RandomInteger(0, sample_range);
+        // If that position was already sampled, the new last one can't be
+        if (std::find(sample_indices.begin(), sample_indices.end(), index) !=
+                sample_indices.end())
+            index = sample_range;
+        sample_indices.push_back(index);
+        samples.push_back(first[index]);
+    }
+    return samples;
+}
+
 /** Randomly sample the input vector.
  *
  * The samples are uniformly randomly distributed.
  *
- * Worst-case performance: O(num_samples * vec.size())
+ * Worst-case performance: O(num_samples^2)
  *
  * @param vec   Vector to be sampled.
  * @return      Vector containing the random samples.
@@ -0,0 +1,47 @@
+/** Runtime selection of SIMD code paths.
+ *
+ * The vectorized algorithms are compiled once per instruction set (in source
+ * files named `*_sse4.cpp`, `*_avx2.cpp`, ..., which the build compiles with
+ * that instruction set enabled) and pick one when called, according to
+ * `ActiveSimdLevel()`. So one binary uses the best code the CPU can run, and
+ * the slower paths can still be tested and benchmarked on a fast machine by
+ * lowering the level with `SetSimdLevel()`.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_SIMD_HPP
+#define ALGORITHMS_STUDY_CPP_SIMD_HPP
+
+
+/** Instruction sets with a code path of their own, from slowest to fastest.
+ */
+enum class SimdLevel {
+    kScalar,    ///< Plain C++.
+    kSse41,     ///< SSE4.1 (4 ints per register).
+    kAvx2,      ///< AVX2 (8 ints per register).
+    kAvx512,    ///< AVX-512 Foundation (16 ints per register).
+};
+
+/** Return a printable name of a SIMD level (e.g. "avx2"). */
+const char *SimdLevelName(const SimdLevel level);
+
+/** Return the best SIMD level this CPU (and build) supports.
+ *
+ * Only x86 builds have vector code paths; everything else is `kScalar`.
+ */
+SimdLevel DetectSimdLevel();
+
+/** Return the SIMD level the dispatching functions currently use.
+ *
+ * This is `DetectSimdLevel()` unless lowered by `SetSimdLevel()`.
+ */
+SimdLevel ActiveSimdLevel();
+
+/** Set the SIMD level the dispatching functions use, e.g. to compare paths.
+ *
+ * @param level     Level to use; levels above `DetectSimdLevel()` are
+ *      lowered to it.
+ * @return          The level actually set.
+ */
+SimdLevel SetSimdLevel(const SimdLevel level);
+
+#endif //ALGORITHMS_STUDY_CPP_SIMD_HPP
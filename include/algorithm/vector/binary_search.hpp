@@ -0,0 +1,259 @@
+/** Binary search of sorted ranges: lower and upper bounds, equal ranges, and
+ * many lookups at once.
+ *
+ * The searches are iterative and branchless: each step moves the base of
+ * the range with a conditional move instead of a branch the CPU would
+ * mispredict half the time, so what is left is the memory latency of each
+ * step's load, which prefetching and batching hide.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_BINARY_SEARCH_HPP
+#define ALGORITHMS_STUDY_CPP_BINARY_SEARCH_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "algorithm/counters.hpp"
+#include "algorithm/vector/generic_heap.hpp"
+
+
+/** Searches interleaved by `BatchedLowerBound` and `BatchedUpperBound`.
+ *
+ * Enough that a step's loads for the whole batch are in flight together.
+ */
+const int kBinarySearchBatchSize = 32;
+
+namespace detail {
+
+/** Compare a projected item with an (already projected) value. */
+template <typename Compare, typename Projection, typename T, typename U>
+inline bool ItemLessThanValue(
+        Compare &comp, Projection &proj, const T &item, const U &value) {
+    COUNT_COMPARISONS(1);
+    return comp(proj(item), value);
+}
+
+/** Compare an (already projected) value with a projected item. */
+template <typename Compare, typename Projection, typename T, typename U>
+inline bool ValueLessThanItem(
+        Compare &comp, Projection &proj, const T &value, const U &item) {
+    COUNT_COMPARISONS(1);
+    return comp(value, proj(item));
+}
+
+/** Prefetch the item at `position`, if the compiler can. */
+template <typename RandomIt>
+inline void PrefetchItem(RandomIt position) {
+#if defined(__GNUC__)
+    __builtin_prefetch(&*position);
+#else
+    (void)position;
+#endif
+}
+
+/** Branchless binary search; `upper` picks the upper bound. */
+template <bool upper, typename RandomIt, typename T, typename Compare,
+          typename Projection>
+RandomIt BranchlessBound(
+        RandomIt first, RandomIt last, const T &value,
+        Compare &comp, Projection &proj) {
+    auto size = last - first;
+    if (size == 0)
+        return first;
+    // The bound is in [first, first + size] throughout
+    while (size > 1) {
+        auto half = size / 2;
+        size -= half;
+        // Prefetch both places the next step could look, as we can't know
+        // which it will be until this step's load arrives
+        PrefetchItem(first + size / 2);
+        PrefetchItem(first + half + size / 2);
+        bool right = upper
+            ? !ValueLessThanItem(comp, proj, value, first[half])
+            : ItemLessThanValue(comp, proj, first[half], value);
+        first += right ? half : 0;
+    }
+    bool right = upper
+        ? !ValueLessThanItem(comp, proj, value, *first)
+        : ItemLessThanValue(comp, proj, *first, value);
+    return first + (right ? 1 : 0);
+}
+
+/** Interleaved branchless binary searches for a batch of values. */
+template <bool upper, typename RandomIt, typename InputIt, typename OutputIt,
+          typename Compare, typename Projection>
+OutputIt BatchedBound(
+        RandomIt first, RandomIt last, InputIt value_first, InputIt value_last,
+        OutputIt output, Compare &comp, Projection &proj) {
+    typedef typename std::iterator_traits<InputIt>::value_type Value;
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    Value values[kBinarySearchBatchSize];
+    Index offsets[kBinarySearchBatchSize];
+    while (value_first != value_last) {
+        int batch_size = 0;
+        for (; batch_size < kBinarySearchBatchSize && value_first != value_last;
+             ++batch_size, ++value_first) {
+            values[batch_size] = *value_first;
+            offsets[batch_size] = 0;
+        }
+
+        // All the searches are over the same range, so they take the same
+        // steps; doing a step of each in turn overlaps their cache misses
+        auto size = last - first;
+        while (size > 1) {
+            auto half = size / 2;
+            size -= half;
+            for (int i = 0; i < batch_size; ++i) {
+                RandomIt base = first + offsets[i];
+                bool right = upper
+                    ? !ValueLessThanItem(comp, proj, values[i], base[half])
+                    : ItemLessThanValue(comp, proj, base[half], values[i]);
+                offsets[i] += right * half;
+                PrefetchItem(first + (offsets[i] + size / 2));
+            }
+        }
+        for (int i = 0; i < batch_size; ++i) {
+            if (size == 1) {
+                RandomIt base = first + offsets[i];
+                bool right = upper
+                    ? !ValueLessThanItem(comp, proj, values[i], *base)
+                    : ItemLessThanValue(comp, proj, *base, values[i]);
+                offsets[i] += right;
+            }
+            *output = first + offsets[i];
+            ++output;
+        }
+    }
+    return output;
+}
+
+} // namespace detail
+
+/** Return the first position in the sorted range whose item is not less
+ * than the value.
+ *
+ * Like `std::lower_bound`, but the loop has no data-dependent branch, and
+ * the two items the next step might look at are prefetched while this one
+ * waits for its own.
+ *
+ * Worst-case performance: Theta(lg n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param last  Iterator after the last item of the range.
+ * @param value Value searched for (compared with projected items).
+ * @param comp  Strict weak ordering the projected items are sorted by.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Iterator to the first item not less than `value` (or `last`).
+ */
+template <typename RandomIt, typename T, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt LowerBound(
+        RandomIt first, RandomIt last, const T &value,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    return detail::BranchlessBound<false>(first, last, value, comp, proj);
+}
+
+/** Return the first position in the sorted range whose item is greater than
+ * the value.
+ *
+ * The branchless, prefetching counterpart of `std::upper_bound` (see
+ * `LowerBound`).
+ *
+ * Worst-case performance: Theta(lg n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param last  Iterator after the last item of the range.
+ * @param value Value searched for (compared with projected items).
+ * @param comp  Strict weak ordering the projected items are sorted by.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Iterator to the first item greater than `value` (or `last`).
+ */
+template <typename RandomIt, typename T, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt UpperBound(
+        RandomIt first, RandomIt last, const T &value,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    return detail::BranchlessBound<true>(first, last, value, comp, proj);
+}
+
+/** Return the range of items of the sorted range equivalent to the value.
+ *
+ * The upper bound is only searched for from the lower one onwards.
+ *
+ * Worst-case performance: Theta(lg n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param last  Iterator after the last item of the range.
+ * @param value Value searched for (compared with projected items).
+ * @param comp  Strict weak ordering the projected items are sorted by.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Pair of the `LowerBound` and `UpperBound` of `value`.
+ */
+template <typename RandomIt, typename T, typename Compare = Less,
+          typename Projection = Identity>
+std::pair<RandomIt, RandomIt> EqualRange(
+        RandomIt first, RandomIt last, const T &value,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    RandomIt lower = detail::BranchlessBound<false>(
+        first, last, value, comp, proj);
+    return std::make_pair(
+        lower, detail::BranchlessBound<true>(lower, last, value, comp, proj));
+}
+
+/** Write the `LowerBound` of each of many values in the sorted range.
+ *
+ * The searches are done `kBinarySearchBatchSize` at a time, one step of
+ * each in turn, so a batch's cache misses overlap instead of each search
+ * waiting out its own: on a range much bigger than the cache this is several
+ * times the throughput of searching for the values one by one.
+ *
+ * Worst-case performance: Theta(m lg n), for m values
+ *
+ * @param first         Iterator to the first item of the range.
+ * @param last          Iterator after the last item of the range.
+ * @param value_first   Iterator to the first value searched for.
+ * @param value_last    Iterator after the last value searched for.
+ * @param output        Iterator the positions found (iterators into the
+ *                      range) are written to, in the order of the values.
+ * @param comp          Strict weak ordering the projected items are sorted by.
+ * @param proj          Projection applied to items before comparing them.
+ * @return              Iterator after the last position written.
+ */
+template <typename RandomIt, typename InputIt, typename OutputIt,
+          typename Compare = Less, typename Projection = Identity>
+OutputIt BatchedLowerBound(
+        RandomIt first, RandomIt last, InputIt value_first, InputIt value_last,
+        OutputIt output,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    return detail::BatchedBound<false>(
+        first, last, value_first, value_last, output, comp, proj);
+}
+
+/** Write the `UpperBound` of each of many values in the sorted range.
+ *
+ * Batched like `BatchedLowerBound`.
+ *
+ * Worst-case performance: Theta(m lg n), for m values
+ *
+ * @param first         Iterator to the first item of the range.
+ * @param last          Iterator after the last item of the range.
+ * @param value_first   Iterator to the first value searched for.
+ * @param value_last    Iterator after the last value searched for.
+ * @param output        Iterator the positions found (iterators into the
+ *                      range) are written to, in the order of the values.
+ * @param comp          Strict weak ordering the projected items are sorted by.
+ * @param proj          Projection applied to items before comparing them.
+ * @return              Iterator after the last position written.
+ */
+template <typename RandomIt, typename InputIt, typename OutputIt,
+          typename Compare = Less, typename Projection = Identity>
+OutputIt BatchedUpperBound(
+        RandomIt first, RandomIt last, InputIt value_first, InputIt value_last,
+        OutputIt output,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    return detail::BatchedBound<true>(
+        first, last, value_first, value_last, output, comp, proj);
+}
+
+#endif //ALGORITHMS_STUDY_CPP_BINARY_SEARCH_HPP
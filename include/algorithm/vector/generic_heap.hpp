@@ -0,0 +1,279 @@
+/** Generic versions of the binary heap functions.
+ *
+ * These work on any random-access iterator range holding a heap (index 0 at
+ * the iterator `first`), ordering items by `comp(proj(a), proj(b))`. The
+ * `std::vector<int>` functions in `heap.hpp` are thin wrappers around them.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_GENERIC_HEAP_HPP
+#define ALGORITHMS_STUDY_CPP_GENERIC_HEAP_HPP
+
+#include <iterator>
+#include <utility>
+
+#include "algorithm/counters.hpp"
+
+
+/** Projection that returns its argument unchanged.
+ */
+struct Identity {
+    template <typename T>
+    T &&operator()(T &&value) const { return std::forward<T>(value); }
+};
+
+/** Comparator that orders items with `operator<`.
+ */
+struct Less {
+    template <typename T, typename U>
+    bool operator()(const T &a, const U &b) const { return a < b; }
+};
+
+/** Comparator that orders items with `operator>`.
+ */
+struct Greater {
+    template <typename T, typename U>
+    bool operator()(const T &a, const U &b) const { return a > b; }
+};
+
+namespace detail {
+
+/** Return whether `a` comes before `b` under the projected ordering.
+ */
+template <typename Compare, typename Projection, typename T, typename U>
+inline bool ProjectedLess(
+        Compare &comp, Projection &proj, const T &a, const U &b) {
+    COUNT_COMPARISONS(1);
+    return comp(proj(a), proj(b));
+}
+
+/** Swap the items the two iterators point to.
+ */
+template <typename RandomIt>
+inline void SwapItems(RandomIt a, RandomIt b) {
+    using std::swap;
+    swap(*a, *b);
+    COUNT_SWAPS(1);
+}
+
+/** Move the item an iterator points to out into a new item.
+ *
+ * Iterators whose `*it` is a proxy (like those of `sort_by_key.hpp`) provide
+ * their own `IterMove`, found by argument-dependent lookup as `swap` is:
+ * `std::move(*it)` can only convert a proxy to an item by copying.
+ */
+template <typename It>
+inline typename std::iterator_traits<It>::value_type IterMove(It it) {
+    return std::move(*it);
+}
+
+} // namespace detail
+
+/** Enforce the max-heap property on the specified node.
+ *
+ * \warning{
+ * Assumes the subtrees rooted at the children of the specified node are max-
+ * heaps!}
+ *
+ * @param first         Iterator to the root of the heap.
+ * @param node          Index of the node to be max-heapified.
+ * @param heap_order    Number of nodes in the max-heap.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MaxHeapify(
+        RandomIt first,
+        typename std::iterator_traits<RandomIt>::difference_type node,
+        const typename std::iterator_traits<RandomIt>::difference_type
+            heap_order,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    while (true) {
+        Index left_child = 2 * node + 1;
+        Index right_child = left_child + 1;
+
+        Index largest_node = node;
+        if (left_child < heap_order && detail::ProjectedLess(
+                comp, proj, first[node], first[left_child]))
+            largest_node = left_child;
+        if (right_child < heap_order && detail::ProjectedLess(
+                comp, proj, first[largest_node], first[right_child]))
+            largest_node = right_child;
+
+        if (largest_node == node)
+            return;
+        detail::SwapItems(first + node, first + largest_node);
+        node = largest_node;
+    }
+}
+
+/** Enforce the min-heap property on the specified node.
+ *
+ * \warning{
+ * Assumes the subtrees rooted at the children of the specified node are min-
+ * heaps!}
+ *
+ * @param first         Iterator to the root of the heap.
+ * @param node          Index of the node to be min-heapified.
+ * @param heap_order    Number of nodes in the min-heap.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MinHeapify(
+        RandomIt first,
+        typename std::iterator_traits<RandomIt>::difference_type node,
+        const typename std::iterator_traits<RandomIt>::difference_type
+            heap_order,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    while (true) {
+        Index left_child = 2 * node + 1;
+        Index right_child = left_child + 1;
+
+        Index smallest_node = node;
+        if (left_child < heap_order && detail::ProjectedLess(
+                comp, proj, first[left_child], first[node]))
+            smallest_node = left_child;
+        if (right_child < heap_order && detail::ProjectedLess(
+                comp, proj, first[right_child], first[smallest_node]))
+            smallest_node = right_child;
+
+        if (smallest_node == node)
+            return;
+        detail::SwapItems(first + node, first + smallest_node);
+        node = smallest_node;
+    }
+}
+
+/** Rearrange the items in the range so it becomes a binary max-heap.
+ *
+ * Worst-case performance: O(n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param last  Iterator after the last item of the range.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MaxHeapBuilder(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto heap_order = last - first;
+    for (auto node = heap_order / 2 - 1; node >= 0; --node)
+        MaxHeapify(first, node, heap_order, comp, proj);
+}
+
+/** Rearrange the items in the range so it becomes a binary min-heap.
+ *
+ * Worst-case performance: O(n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param last  Iterator after the last item of the range.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MinHeapBuilder(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto heap_order = last - first;
+    for (auto node = heap_order / 2 - 1; node >= 0; --node)
+        MinHeapify(first, node, heap_order, comp, proj);
+}
+
+/** Add the last item of the range to the max-heap made of the items before it.
+ *
+ * Worst-case performance: O(lg n)
+ *
+ * @param first Iterator to the root of the heap.
+ * @param last  Iterator after the item to be inserted; `[first, last - 1)`
+ *      must be a max-heap.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MaxHeapInsert(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto node = last - first - 1;
+    while (node > 0) {
+        auto parent = (node - 1) / 2;
+        if (!detail::ProjectedLess(comp, proj, first[parent], first[node]))
+            return;
+        detail::SwapItems(first + parent, first + node);
+        node = parent;
+    }
+}
+
+/** Add the last item of the range to the min-heap made of the items before it.
+ *
+ * Worst-case performance: O(lg n)
+ *
+ * @param first Iterator to the root of the heap.
+ * @param last  Iterator after the item to be inserted; `[first, last - 1)`
+ *      must be a min-heap.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MinHeapInsert(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto node = last - first - 1;
+    while (node > 0) {
+        auto parent = (node - 1) / 2;
+        if (!detail::ProjectedLess(comp, proj, first[node], first[parent]))
+            return;
+        detail::SwapItems(first + parent, first + node);
+        node = parent;
+    }
+}
+
+/** Move the largest item of a max-heap to the end of the range.
+ *
+ * The items before it are left as a max-heap.
+ *
+ * Worst-case performance: O(lg n)
+ *
+ * @param first Iterator to the root of the heap.
+ * @param last  Iterator after the last item of the (non-empty) heap.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MaxHeapExtractMax(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    detail::SwapItems(first, last - 1);
+    MaxHeapify(first, 0, last - first - 1, comp, proj);
+}
+
+/** Move the smallest item of a min-heap to the end of the range.
+ *
+ * The items before it are left as a min-heap.
+ *
+ * Worst-case performance: O(lg n)
+ *
+ * @param first Iterator to the root of the heap.
+ * @param last  Iterator after the last item of the (non-empty) heap.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MinHeapExtractMin(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    detail::SwapItems(first, last - 1);
+    MinHeapify(first, 0, last - first - 1, comp, proj);
+}
+
+#endif //ALGORITHMS_STUDY_CPP_GENERIC_HEAP_HPP
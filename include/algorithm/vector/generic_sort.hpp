@@ -0,0 +1,1676 @@
+/** Generic versions of the sorting functions.
+ *
+ * These work on any random-access iterator range, ordering items by
+ * `comp(proj(a), proj(b))`, so 64-bit keys, floats or structs can be sorted
+ * directly (e.g. structs by one member, via the projection) and the comparison
+ * can be inlined. The `std::vector<int>` functions in `sort.hpp` are thin
+ * wrappers around these.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_GENERIC_SORT_HPP
+#define ALGORITHMS_STUDY_CPP_GENERIC_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "algorithm/counters.hpp"
+#include "algorithm/random.hpp"
+#include "algorithm/vector/generic_heap.hpp"
+#include "algorithm/vector/kway_merge.hpp"
+#include "algorithm/vector/sorting_network.hpp"
+#include "algorithm/vector/vectorized_partition.hpp"
+
+
+/** Insert an item into its correct place in the sorted range before it.
+ *
+ * It is assumed that `[first, position)` is already sorted.
+ *
+ * @param first     Iterator to the first item of the sorted range.
+ * @param position  Iterator to the item to be inserted into the sorted range.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void InsertIntoSortedSubvector(
+        RandomIt first, RandomIt position,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    using detail::IterMove;
+    typename std::iterator_traits<RandomIt>::value_type value_to_be_inserted =
+        IterMove(position);
+
+    // We compare the item to each item before it in the range
+    RandomIt search = position;
+    while (search != first && detail::ProjectedLess(
+            comp, proj, value_to_be_inserted, *(search - 1))) {
+        *search = std::move(*(search - 1));
+        COUNT_MOVES(1);
+        --search;
+    }
+    *search = std::move(value_to_be_inserted);
+    COUNT_MOVES(1);
+}
+
+/** Sort the range (in-place) using the "insertion sort" algorithm.
+ *
+ * Worst-case performance: O(n^2)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void InsertionSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    if (last - first < 2)
+        return;
+    for (RandomIt key = first + 1; key != last; ++key)
+        InsertIntoSortedSubvector(first, key, comp, proj);
+}
+
+namespace detail {
+
+/** How the recursive sorts finish off short ranges.
+ *
+ * By default short ranges are insertion-sorted, and `LeafSize` keeps the
+ * caller's own insertion sort cutoff. Ranges of ints in ascending order are
+ * specialized below to use sorting networks instead, which stay fast on
+ * longer leaves.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+struct SmallSorter {
+    /** Longest range the sort should hand to `Sort`. */
+    static int LeafSize(const int insertion_cutoff) {
+        return insertion_cutoff;
+    }
+
+    static void Sort(
+            RandomIt first, RandomIt last, Compare &comp, Projection &proj) {
+        InsertionSort(first, last, comp, proj);
+    }
+};
+
+/** Short ranges of contiguous ints are sorted by `SortingNetworkSort`.
+ */
+template <typename RandomIt>
+struct SortingNetworkSmallSorter {
+    static int LeafSize(const int) {
+        return kSortingNetworkMaxSize;
+    }
+
+    template <typename Compare, typename Projection>
+    static void Sort(RandomIt first, RandomIt last, Compare &, Projection &) {
+        if (last - first > 1)
+            SortingNetworkSort(&*first, (int)(last - first));
+    }
+};
+
+template <>
+struct SmallSorter<int *, Less, Identity>
+    : SortingNetworkSmallSorter<int *> {};
+
+template <>
+struct SmallSorter<std::vector<int>::iterator, Less, Identity>
+    : SortingNetworkSmallSorter<std::vector<int>::iterator> {};
+
+/** Return the longest range a recursive sort should finish with
+ * `SortSmallRange`, given the insertion sort cutoff it would otherwise use.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+int LeafSize(
+        RandomIt, const Compare &, const Projection &,
+        const int insertion_cutoff) {
+    return SmallSorter<RandomIt, Compare, Projection>::LeafSize(
+        insertion_cutoff);
+}
+
+/** Sort a short range (in-place), with the best method for its item type.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void SortSmallRange(
+        RandomIt first, RandomIt last, Compare &comp, Projection &proj) {
+    SmallSorter<RandomIt, Compare, Projection>::Sort(first, last, comp, proj);
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) using a recursive insertion sort.
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void InsertionSortRecursive(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    if (last - first < 2)
+        return;
+    InsertionSortRecursive(first, last - 1, comp, proj);
+    InsertIntoSortedSubvector(first, last - 1, comp, proj);
+}
+
+/** Sort the range (in-place) using the "selection sort" algorithm.
+ *
+ * Worst-case performance: O(n^2)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void SelectionSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    for (RandomIt position = first; last - position > 1; ++position) {
+        RandomIt min_position = position;
+        for (RandomIt search = position + 1; search != last; ++search)
+            if (detail::ProjectedLess(comp, proj, *search, *min_position))
+                min_position = search;
+        if (min_position != position)
+            detail::SwapItems(position, min_position);
+    }
+}
+
+/** Stably merge two sorted ranges into an output range.
+ *
+ * Bounds are checked instead of relying on sentinels, so any values (including
+ * the largest representable one) can be merged. The output must not overlap
+ * either input.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first1    Iterator to the first item of the first range.
+ * @param last1     Iterator after the last item of the first range.
+ * @param first2    Iterator to the first item of the second range.
+ * @param last2     Iterator after the last item of the second range.
+ * @param output    Iterator to the start of the output range.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ * @return          Iterator after the last item written.
+ */
+template <typename InputIt1, typename InputIt2, typename OutputIt,
+          typename Compare = Less, typename Projection = Identity>
+OutputIt MergeSortedRanges(
+        InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+        OutputIt output,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    while (first1 != last1 && first2 != last2) {
+        if (detail::ProjectedLess(comp, proj, *first2, *first1))
+            *output++ = std::move(*first2++);
+        else
+            *output++ = std::move(*first1++);
+        COUNT_MOVES(1);
+    }
+    COUNT_MOVES(std::distance(first1, last1) + std::distance(first2, last2));
+    output = std::move(first1, last1, output);
+    return std::move(first2, last2, output);
+}
+
+/** Merge (in-place) two adjacent sorted ranges into one sorted range.
+ *
+ * The merge is stable: of two equivalent items, the one from the first range
+ * comes first.
+ *
+ * Worst-case performance: O(n)
+ *
+ * @param first     Iterator to the first item of the first range.
+ * @param middle    Iterator to the first item of the second range.
+ * @param last      Iterator after the last item of the second range.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MergeSortedSubvectors(
+        RandomIt first, RandomIt middle, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::value_type Value;
+
+    // Extract the subranges
+    std::vector<Value> subvec1(
+        std::make_move_iterator(first), std::make_move_iterator(middle));
+    std::vector<Value> subvec2(
+        std::make_move_iterator(middle), std::make_move_iterator(last));
+    COUNT_MOVES(last - first);
+
+    MergeSortedRanges(
+        subvec1.begin(), subvec1.end(), subvec2.begin(), subvec2.end(), first,
+        comp, proj);
+}
+
+/** Sort the range (in-place) using the "merge sort" algorithm.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MergeSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    if (last - first <= detail::LeafSize(first, comp, proj, 1)) {
+        detail::SortSmallRange(first, last, comp, proj);
+    }
+    else {
+        RandomIt middle = first + (last - first) / 2;
+
+        MergeSort(first, middle, comp, proj);
+        MergeSort(middle, last, comp, proj);
+        MergeSortedSubvectors(first, middle, last, comp, proj);
+    }
+}
+
+/** Ranges at most this long are insertion sorted by the buffered merge sort.
+ */
+const int kMergeSortInsertionCutoff = 16;
+
+namespace detail {
+
+/** Merge sort `size` items, leaving the result in the range or the buffer.
+ *
+ * Both halves are sorted into the array the result is *not* going to, so each
+ * level of the recursion merges from one array into the other and no items
+ * ever need to be copied back.
+ */
+template <typename RandomIt, typename BufferIt, typename Compare,
+          typename Projection>
+void PingPongMergeSort(
+        RandomIt first, BufferIt buffer,
+        const typename std::iterator_traits<RandomIt>::difference_type size,
+        const bool into_buffer, Compare &comp, Projection &proj) {
+    if (size <= LeafSize(first, comp, proj, kMergeSortInsertionCutoff)) {
+        SortSmallRange(first, first + size, comp, proj);
+        if (into_buffer) {
+            std::move(first, first + size, buffer);
+            COUNT_MOVES(size);
+        }
+        return;
+    }
+
+    auto half = size / 2;
+    PingPongMergeSort(first, buffer, half, !into_buffer, comp, proj);
+    PingPongMergeSort(
+        first + half, buffer + half, size - half, !into_buffer, comp, proj);
+
+    if (into_buffer)
+        MergeSortedRanges(
+            first, first + half, first + half, first + size, buffer,
+            comp, proj);
+    else
+        MergeSortedRanges(
+            buffer, buffer + half, buffer + half, buffer + size, first,
+            comp, proj);
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) by merge sort, using a caller-provided buffer.
+ *
+ * Merges alternate between the range and the buffer instead of copying into
+ * freshly allocated subvectors, so no memory is allocated at all. Small
+ * subranges are insertion sorted. The sort is stable.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first     Iterator to the first item to be sorted.
+ * @param last      Iterator after the last item to be sorted.
+ * @param buffer    Iterator to scratch space for at least `last - first`
+ *      items; its contents are overwritten.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename BufferIt, typename Compare = Less,
+          typename Projection = Identity>
+void MergeSortWithBuffer(
+        RandomIt first, RandomIt last, BufferIt buffer,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    detail::PingPongMergeSort(first, buffer, last - first, false, comp, proj);
+}
+
+/** Sort the range (in-place) by merge sort, allocating one buffer up-front.
+ *
+ * Like `MergeSortWithBuffer`, but allocates the scratch buffer itself (once).
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void BufferedMergeSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(
+        last - first);
+    MergeSortWithBuffer(first, last, buffer.begin(), comp, proj);
+}
+
+/** Runs merged at once by the multiway merge sort.
+ */
+const int kMultiwayMergeSortWays = 8;
+
+/** Sort the range (in-place) by multiway merge sort, using a caller-provided
+ * buffer.
+ *
+ * Bottom-up merge sort that merges `ways` runs at a time with
+ * `MultiwayMerge` (a loser tree), alternating between the range and the
+ * buffer. With k-way merges there are log_k(n) passes over the data instead
+ * of lg n, for about the same number of comparisons, so much less memory
+ * traffic once the range outgrows the caches. Short leaves are sorted first,
+ * like in `MergeSortWithBuffer`. The sort is stable.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first     Iterator to the first item to be sorted.
+ * @param last      Iterator after the last item to be sorted.
+ * @param buffer    Iterator to scratch space for at least `last - first`
+ *      items; its contents are overwritten.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ * @param ways      Runs merged at once (at least 2).
+ */
+template <typename RandomIt, typename BufferIt, typename Compare = Less,
+          typename Projection = Identity>
+void MultiwayMergeSortWithBuffer(
+        RandomIt first, RandomIt last, BufferIt buffer,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const int ways = kMultiwayMergeSortWays) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    Index size = last - first;
+    Index leaf_size = detail::LeafSize(
+        first, comp, proj, kMergeSortInsertionCutoff);
+    for (Index begin = 0; begin < size; begin += leaf_size)
+        detail::SortSmallRange(
+            first + begin, first + std::min(begin + leaf_size, size),
+            comp, proj);
+
+    // Reused by every merge, to avoid an allocation per group
+    std::vector<std::pair<std::move_iterator<BufferIt>,
+                          std::move_iterator<BufferIt>>> buffer_runs;
+    std::vector<std::pair<std::move_iterator<RandomIt>,
+                          std::move_iterator<RandomIt>>> range_runs;
+    bool in_buffer = false;
+    for (Index run_size = leaf_size; run_size < size; run_size *= ways) {
+        for (Index group = 0; group < size; group += run_size * ways) {
+            Index group_end = std::min(group + run_size * ways, size);
+            if (in_buffer) {
+                buffer_runs.clear();
+                for (Index run = group; run < group_end; run += run_size)
+                    buffer_runs.push_back(std::make_pair(
+                        std::make_move_iterator(buffer + run),
+                        std::make_move_iterator(
+                            buffer + std::min(run + run_size, size))));
+                MultiwayMerge(buffer_runs, first + group, comp, proj);
+            }
+            else {
+                range_runs.clear();
+                for (Index run = group; run < group_end; run += run_size)
+                    range_runs.push_back(std::make_pair(
+                        std::make_move_iterator(first + run),
+                        std::make_move_iterator(
+                            first + std::min(run + run_size, size))));
+                MultiwayMerge(range_runs, buffer + group, comp, proj);
+            }
+        }
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) {
+        std::move(buffer, buffer + size, first);
+        COUNT_MOVES(size);
+    }
+}
+
+/** Sort the range (in-place) by multiway merge sort.
+ *
+ * Like `MultiwayMergeSortWithBuffer`, but allocates the scratch buffer itself.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @param ways  Runs merged at once (at least 2).
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void MultiwayMergeSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const int ways = kMultiwayMergeSortWays) {
+    std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(
+        last - first);
+    MultiwayMergeSortWithBuffer(first, last, buffer.begin(), comp, proj, ways);
+}
+
+/** Runs shorter than this are extended (by binary insertion) by the adaptive
+ * merge sort.
+ */
+const int kAdaptiveMergeSortMinMerge = 32;
+
+/** Consecutive wins by one run that switch the adaptive merge to galloping.
+ */
+const int kAdaptiveMergeSortMinGallop = 7;
+
+namespace detail {
+
+/** Orders items the other way around (for merging from the back). */
+template <typename Compare>
+struct ReversedCompare {
+    Compare comp;
+
+    template <typename T, typename U>
+    bool operator()(const T &a, const U &b) {
+        return comp(b, a);
+    }
+};
+
+/** Sort `[first, last)` by binary insertion, given `[first, start)` sorted.
+ *
+ * Each item's place is found by binary search (after any equivalent items,
+ * for stability), so this does only O(n log n) comparisons, although still
+ * O(n^2) moves.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void BinaryInsertionSort(
+        RandomIt first, RandomIt start, RandomIt last,
+        Compare &comp, Projection &proj) {
+    for (RandomIt position = start; position != last; ++position) {
+        RandomIt low = first, high = position;
+        while (low < high) {
+            RandomIt middle = low + (high - low) / 2;
+            if (ProjectedLess(comp, proj, *position, *middle))
+                high = middle;
+            else
+                low = middle + 1;
+        }
+        typename std::iterator_traits<RandomIt>::value_type value =
+            IterMove(position);
+        std::move_backward(low, position, position + 1);
+        *low = std::move(value);
+        COUNT_MOVES(position - low + 2);
+    }
+}
+
+/** Return the length of the run at `first`, making it ascending.
+ *
+ * A run is a longest prefix that is either non-descending, or strictly
+ * descending; the latter is reversed in place (reversing equal items would
+ * break stability, hence "strictly").
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+typename std::iterator_traits<RandomIt>::difference_type
+CountRunAndMakeAscending(
+        RandomIt first, RandomIt last, Compare &comp, Projection &proj) {
+    RandomIt run_end = first + 1;
+    if (run_end == last)
+        return 1;
+    if (ProjectedLess(comp, proj, *run_end, *first)) {
+        ++run_end;
+        while (run_end != last &&
+               ProjectedLess(comp, proj, *run_end, *(run_end - 1)))
+            ++run_end;
+        std::reverse(first, run_end);
+        COUNT_SWAPS((run_end - first) / 2);
+    }
+    else {
+        ++run_end;
+        while (run_end != last &&
+               !ProjectedLess(comp, proj, *run_end, *(run_end - 1)))
+            ++run_end;
+    }
+    return run_end - first;
+}
+
+/** Return the shortest run length worth merging, for `size` items.
+ *
+ * Chosen so that `size / length` is a power of two, or a little less than
+ * one, which keeps the final merges balanced.
+ */
+template <typename Index>
+Index AdaptiveMinRunLength(Index size) {
+    Index remainder_bits = 0;
+    while (size >= kAdaptiveMergeSortMinMerge) {
+        remainder_bits |= size & 1;
+        size >>= 1;
+    }
+    return size + remainder_bits;
+}
+
+/** Return how many items of the sorted range go before `key`.
+ *
+ * Exponential search from the start, then binary search, so this takes
+ * O(log k) comparisons when the answer is k. Equivalent items count as
+ * going *after* `key` (lower bound).
+ */
+template <typename RandomIt, typename T, typename Compare,
+          typename Projection>
+typename std::iterator_traits<RandomIt>::difference_type GallopLeft(
+        const T &key, RandomIt first, RandomIt last,
+        Compare &comp, Projection &proj) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    Index size = last - first;
+    Index low = 0, high = 1;
+    while (high <= size && ProjectedLess(comp, proj, first[high - 1], key)) {
+        low = high;
+        high = 2 * high + 1;
+    }
+    // Now the answer is in [low, min(high, size)]
+    high = std::min(high, size);
+    while (low < high) {
+        Index middle = low + (high - low) / 2;
+        if (ProjectedLess(comp, proj, first[middle], key))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/** Like `GallopLeft`, but equivalent items count as going before `key`
+ * (upper bound).
+ */
+template <typename RandomIt, typename T, typename Compare,
+          typename Projection>
+typename std::iterator_traits<RandomIt>::difference_type GallopRight(
+        const T &key, RandomIt first, RandomIt last,
+        Compare &comp, Projection &proj) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    Index size = last - first;
+    Index low = 0, high = 1;
+    while (high <= size && !ProjectedLess(comp, proj, key, first[high - 1])) {
+        low = high;
+        high = 2 * high + 1;
+    }
+    high = std::min(high, size);
+    while (low < high) {
+        Index middle = low + (high - low) / 2;
+        if (ProjectedLess(comp, proj, key, first[middle]))
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    return low;
+}
+
+/** Merge run A (moved out to the buffer) and run B into `output`.
+ *
+ * `output` is where A used to be, directly before B, so it never catches up
+ * with the unmerged part of B. Ties go to A. Items are merged one at a time
+ * until one run wins `min_gallop` times in a row; then the merge gallops,
+ * finding with `GallopRight`/`GallopLeft` how many items in a row each run
+ * wins and moving them as a block, until the blocks get short again.
+ * `min_gallop` adapts: it drops while galloping pays off and rises when it
+ * doesn't, so random data soon stops trying.
+ */
+template <typename BufferIt, typename RandomIt, typename Compare,
+          typename Projection>
+void GallopingMerge(
+        BufferIt a, BufferIt a_last, RandomIt b, RandomIt b_last,
+        RandomIt output, Compare &comp, Projection &proj, int &min_gallop) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    while (a != a_last && b != b_last) {
+        // Merge one item at a time
+        Index a_wins = 0, b_wins = 0;
+        while (a_wins < min_gallop && b_wins < min_gallop) {
+            COUNT_MOVES(1);
+            if (ProjectedLess(comp, proj, *b, *a)) {
+                *output++ = std::move(*b++);
+                ++b_wins;
+                a_wins = 0;
+                if (b == b_last)
+                    break;
+            }
+            else {
+                *output++ = std::move(*a++);
+                ++a_wins;
+                b_wins = 0;
+                if (a == a_last)
+                    break;
+            }
+        }
+        if (a == a_last || b == b_last)
+            break;
+
+        // Gallop while either run keeps winning long stretches
+        do {
+            a_wins = GallopRight(*b, a, a_last, comp, proj);
+            output = std::move(a, a + a_wins, output);
+            a += a_wins;
+            COUNT_MOVES(a_wins + 1);
+            if (a == a_last)
+                break;
+            *output++ = std::move(*b++);
+            if (b == b_last)
+                break;
+
+            b_wins = GallopLeft(*a, b, b_last, comp, proj);
+            output = std::move(b, b + b_wins, output);
+            b += b_wins;
+            COUNT_MOVES(b_wins + 1);
+            if (b == b_last)
+                break;
+            *output++ = std::move(*a++);
+            if (a == a_last)
+                break;
+
+            if (min_gallop > 1)
+                --min_gallop;
+        } while (a_wins >= kAdaptiveMergeSortMinGallop ||
+                 b_wins >= kAdaptiveMergeSortMinGallop);
+        // Galloping stopped paying off: make it harder to get back into
+        min_gallop += 2;
+    }
+    // What is left of B is already in place
+    COUNT_MOVES(a_last - a);
+    std::move(a, a_last, output);
+}
+
+/** A sorted run on the adaptive merge sort's stack. */
+template <typename Index>
+struct PendingRun {
+    Index begin;
+    Index size;
+};
+
+/** Merge the adjacent runs `runs[i]` and `runs[i + 1]`.
+ *
+ * The items of the first run that go before all of the second, and those
+ * of the second that go after all of the first, are already in place and
+ * are found by galloping. The shorter of the remaining runs is moved to
+ * the buffer, and the merge goes forwards or, when the second run is the
+ * shorter, backwards (merging forwards on reversed ranges).
+ */
+template <typename RandomIt, typename BufferIt, typename Compare,
+          typename Projection>
+void MergePendingRuns(
+        RandomIt first, std::vector<PendingRun<typename
+            std::iterator_traits<RandomIt>::difference_type>> &runs,
+        const std::size_t i, BufferIt buffer,
+        Compare &comp, Projection &proj, int &min_gallop) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    RandomIt first1 = first + runs[i].begin;
+    RandomIt first2 = first + runs[i + 1].begin;
+    Index size1 = runs[i].size, size2 = runs[i + 1].size;
+    runs[i].size += size2;
+    runs.erase(runs.begin() + i + 1);
+
+    Index skipped = GallopRight(*first2, first1, first2, comp, proj);
+    first1 += skipped;
+    size1 -= skipped;
+    if (size1 == 0)
+        return;
+    size2 = GallopLeft(*(first2 - 1), first2, first2 + size2, comp, proj);
+    if (size2 == 0)
+        return;
+
+    if (size1 <= size2) {
+        std::move(first1, first2, buffer);
+        COUNT_MOVES(size1);
+        GallopingMerge(
+            buffer, buffer + size1, first2, first2 + size2, first1,
+            comp, proj, min_gallop);
+    }
+    else {
+        std::move(first2, first2 + size2, buffer);
+        COUNT_MOVES(size2);
+        ReversedCompare<Compare> reversed_comp = {comp};
+        GallopingMerge(
+            std::reverse_iterator<BufferIt>(buffer + size2),
+            std::reverse_iterator<BufferIt>(buffer),
+            std::reverse_iterator<RandomIt>(first2),
+            std::reverse_iterator<RandomIt>(first1),
+            std::reverse_iterator<RandomIt>(first2 + size2),
+            reversed_comp, proj, min_gallop);
+    }
+}
+
+/** Merge runs on top of the stack until its invariants hold again.
+ *
+ * The invariants, for every three consecutive runs X, Y, Z from the top:
+ * |Z| > |Y| + |X| and |Y| > |X|. They keep the stack O(log n) deep and the
+ * merges balanced. Checking the fourth run from the top too is needed for
+ * them to really hold all the way down the stack.
+ */
+template <typename RandomIt, typename BufferIt, typename Compare,
+          typename Projection>
+void CollapseRuns(
+        RandomIt first, std::vector<PendingRun<typename
+            std::iterator_traits<RandomIt>::difference_type>> &runs,
+        BufferIt buffer, Compare &comp, Projection &proj, int &min_gallop) {
+    while (runs.size() > 1) {
+        std::size_t n = runs.size() - 2;
+        if ((n > 0 && runs[n - 1].size <= runs[n].size + runs[n + 1].size) ||
+            (n > 1 && runs[n - 2].size <= runs[n - 1].size + runs[n].size)) {
+            if (runs[n - 1].size < runs[n + 1].size)
+                --n;
+        }
+        else if (runs[n].size > runs[n + 1].size) {
+            break;
+        }
+        MergePendingRuns(first, runs, n, buffer, comp, proj, min_gallop);
+    }
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) by adaptive ("natural") merge sort.
+ *
+ * Like TimSort: the range is split into the runs it already has (strictly
+ * descending ones are reversed), and runs shorter than a minimum length
+ * (16 to 32 items) are extended by binary insertion. Runs are pushed onto a
+ * stack and merged as soon as that keeps the merges balanced; the merges
+ * gallop through stretches where one run keeps winning. So a sorted or
+ * reversed range takes n - 1 comparisons, and a range made of a few sorted
+ * runs takes O(n log r) for r runs, while random input still takes
+ * O(n log n). Needs a buffer of n / 2 items. The sort is stable.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void AdaptiveMergeSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    Index size = last - first;
+    if (size < 2)
+        return;
+    Index min_run = detail::AdaptiveMinRunLength(size);
+
+    std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(
+        size / 2);
+    std::vector<detail::PendingRun<Index>> runs;
+    int min_gallop = kAdaptiveMergeSortMinGallop;
+    for (Index begin = 0; begin < size; ) {
+        Index run_size = detail::CountRunAndMakeAscending(
+            first + begin, last, comp, proj);
+        if (run_size < min_run) {
+            Index extended_size = std::min(min_run, size - begin);
+            detail::BinaryInsertionSort(
+                first + begin, first + begin + run_size,
+                first + begin + extended_size, comp, proj);
+            run_size = extended_size;
+        }
+        detail::PendingRun<Index> run = {begin, run_size};
+        runs.push_back(run);
+        detail::CollapseRuns(
+            first, runs, buffer.begin(), comp, proj, min_gallop);
+        begin += run_size;
+    }
+
+    // Merge what is left, top down
+    while (runs.size() > 1) {
+        std::size_t n = runs.size() - 2;
+        if (n > 0 && runs[n - 1].size < runs[n + 1].size)
+            --n;
+        detail::MergePendingRuns(
+            first, runs, n, buffer.begin(), comp, proj, min_gallop);
+    }
+}
+
+/** Sort the range (in-place) using the "heapsort" algorithm.
+ *
+ * Worst-case performance: Theta(n lg n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void HeapSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    MaxHeapBuilder(first, last, comp, proj);
+    for (auto heap_order = last - first - 1; heap_order >= 1; --heap_order) {
+        detail::SwapItems(first, first + heap_order);
+        MaxHeapify(first, 0, heap_order, comp, proj);
+    }
+}
+
+/** How the Lomuto-style quicksort partitions move items around the pivot.
+ */
+enum class PartitionScheme {
+    /// One compare-and-branch per item: fast when the outcome is predictable
+    /// (e.g. presorted input), but mispredicts about half the time on random
+    /// input.
+    kLomuto,
+    /// Swaps every item and advances the boundary by the comparison result,
+    /// so the loop has no data-dependent branch.
+    kBranchlessLomuto,
+    /// BlockQuicksort: records the offsets of misplaced items from a block at
+    /// each end of the range without branching, then swaps them in bulk.
+    kBlock,
+    /// Compares a SIMD register of items with the pivot at once and stores
+    /// them packed at either end (see `VectorizedPartition`). Only for ints
+    /// in ascending order; everything else gets `kBlock`.
+    kVectorized
+};
+
+/** Items scanned at a time from each end by the block partition.
+ */
+const int kBlockPartitionBlockSize = 64;
+
+namespace detail {
+
+/** Whether an item belongs left of the pivot in a quicksort partition.
+ */
+template <typename T, typename Compare, typename Projection>
+bool GoesLeftOfPivot(
+        Compare &comp, Projection &proj, const T &item, const T &pivot,
+        const bool equality_check) {
+    return equality_check ?
+        !ProjectedLess(comp, proj, pivot, item) :
+        ProjectedLess(comp, proj, item, pivot);
+}
+
+/** Partition `[first, last)` around a pivot outside it, with a branch per item.
+ *
+ * @return  Iterator to the first item of the right partition.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+RandomIt LomutoSplit(
+        RandomIt first, RandomIt last, RandomIt pivot,
+        Compare &comp, Projection &proj, const bool equality_check) {
+    RandomIt left = first;
+    for (RandomIt right = first; right != last; ++right) {
+        if (GoesLeftOfPivot(comp, proj, *right, *pivot, equality_check)) {
+            SwapItems(left, right);
+            ++left;
+        }
+    }
+    return left;
+}
+
+/** Partition `[first, last)` around a pivot outside it, without branching.
+ *
+ * Each item is swapped to the boundary unconditionally, and the boundary only
+ * moves past it if it belongs on the left; swapping an item with itself or
+ * with an item already on the right is harmless.
+ *
+ * @return  Iterator to the first item of the right partition.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+RandomIt BranchlessLomutoSplit(
+        RandomIt first, RandomIt last, RandomIt pivot,
+        Compare &comp, Projection &proj, const bool equality_check) {
+    RandomIt left = first;
+    for (RandomIt right = first; right != last; ++right) {
+        bool goes_left = GoesLeftOfPivot(
+            comp, proj, *right, *pivot, equality_check);
+        SwapItems(left, right);
+        left += goes_left;
+    }
+    return left;
+}
+
+/** Partition `[first, last)` around a pivot outside it, BlockQuicksort style.
+ *
+ * The offsets of items that are on the wrong side are collected into small
+ * buffers for a block at each end of the range (the comparison result only
+ * decides whether the offset counter is advanced), and then pairs of misplaced
+ * items are swapped. What is left over when fewer than two blocks remain is
+ * finished off by the branchless Lomuto split.
+ *
+ * @return  Iterator to the first item of the right partition.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+RandomIt BlockSplit(
+        RandomIt first, RandomIt last, RandomIt pivot,
+        Compare &comp, Projection &proj, const bool equality_check) {
+    const int block_size = kBlockPartitionBlockSize;
+    unsigned char left_offsets[kBlockPartitionBlockSize];
+    unsigned char right_offsets[kBlockPartitionBlockSize];
+    int num_left = 0;
+    int num_right = 0;
+    int start_left = 0;
+    int start_right = 0;
+
+    // Everything before `left` belongs on the left and everything from `right`
+    // on belongs on the right; the blocks being worked on start at `left` and
+    // end at `right`
+    RandomIt left = first;
+    RandomIt right = last;
+    while (right - left >= 2 * block_size) {
+        if (num_left == 0) {
+            start_left = 0;
+            for (int i = 0; i < block_size; ++i) {
+                left_offsets[num_left] = (unsigned char)i;
+                num_left += !GoesLeftOfPivot(
+                    comp, proj, left[i], *pivot, equality_check);
+            }
+        }
+        if (num_right == 0) {
+            start_right = 0;
+            for (int i = 0; i < block_size; ++i) {
+                right_offsets[num_right] = (unsigned char)i;
+                num_right += GoesLeftOfPivot(
+                    comp, proj, *(right - 1 - i), *pivot, equality_check);
+            }
+        }
+
+        int num_swaps = std::min(num_left, num_right);
+        for (int i = 0; i < num_swaps; ++i)
+            SwapItems(
+                left + left_offsets[start_left + i],
+                right - 1 - right_offsets[start_right + i]);
+        num_left -= num_swaps;
+        num_right -= num_swaps;
+        start_left += num_swaps;
+        start_right += num_swaps;
+
+        // A block is done once it has no misplaced items left
+        if (num_left == 0)
+            left += block_size;
+        if (num_right == 0)
+            right -= block_size;
+    }
+    return BranchlessLomutoSplit(
+        left, right, pivot, comp, proj, equality_check);
+}
+
+/** How `PartitionScheme::kVectorized` splits a range: by default, with
+ * `BlockSplit`. Contiguous ints in ascending order are specialized below.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+struct VectorizedSplitter {
+    static RandomIt Split(
+            RandomIt first, RandomIt last, RandomIt pivot,
+            Compare &comp, Projection &proj, const bool equality_check) {
+        return BlockSplit(first, last, pivot, comp, proj, equality_check);
+    }
+};
+
+/** Contiguous ints are split by `VectorizedPartition`.
+ */
+template <typename RandomIt>
+struct IntVectorizedSplitter {
+    template <typename Compare, typename Projection>
+    static RandomIt Split(
+            RandomIt first, RandomIt last, RandomIt pivot,
+            Compare &, Projection &, const bool equality_check) {
+        if (first == last)
+            return first;
+        int *data = &*first;
+        return first + (VectorizedPartition(
+            data, data + (last - first), *pivot, equality_check) - data);
+    }
+};
+
+template <>
+struct VectorizedSplitter<int *, Less, Identity>
+    : IntVectorizedSplitter<int *> {};
+
+template <>
+struct VectorizedSplitter<std::vector<int>::iterator, Less, Identity>
+    : IntVectorizedSplitter<std::vector<int>::iterator> {};
+
+/** Partition `[first, last)` around a pivot outside it, with SIMD if the
+ * items allow it.
+ *
+ * @return  Iterator to the first item of the right partition.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+RandomIt VectorizedSplit(
+        RandomIt first, RandomIt last, RandomIt pivot,
+        Compare &comp, Projection &proj, const bool equality_check) {
+    return VectorizedSplitter<RandomIt, Compare, Projection>::Split(
+        first, last, pivot, comp, proj, equality_check);
+}
+
+} // namespace detail
+
+/** Rearrange the range (in-place), partitioning it for quicksort.
+ *
+ * Uses the last item of the range as a 'pivot', and partitions the range such
+ * that items before the pivot are not greater than it, and items after the
+ * pivot are greater than it.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first             Iterator to the first item to be partitioned.
+ * @param last              Iterator after the last item to be partitioned.
+ * @param comp              Strict weak ordering of the projected items.
+ * @param proj              Projection applied to items before comparing them.
+ * @param equality_check    If true, the left partition will contain items
+ *      equivalent to the pivot. Otherwise, they will be in the right partition.
+ * @param scheme            How items are moved; all schemes give a valid
+ *      partition, but not necessarily the same arrangement of items.
+ * @return                  Iterator to the pivot after partitioning.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt QuicksortPartition(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const bool equality_check = true,
+        const PartitionScheme scheme = PartitionScheme::kLomuto) {
+    RandomIt pivot = last - 1;
+    RandomIt left;
+    switch (scheme) {
+        case PartitionScheme::kBranchlessLomuto:
+            left = detail::BranchlessLomutoSplit(
+                first, pivot, pivot, comp, proj, equality_check);
+            break;
+        case PartitionScheme::kBlock:
+            left = detail::BlockSplit(
+                first, pivot, pivot, comp, proj, equality_check);
+            break;
+        case PartitionScheme::kVectorized:
+            left = detail::VectorizedSplit(
+                first, pivot, pivot, comp, proj, equality_check);
+            break;
+        default:
+            left = detail::LomutoSplit(
+                first, pivot, pivot, comp, proj, equality_check);
+            break;
+    }
+    detail::SwapItems(left, pivot);
+    return left;
+}
+
+/** Rearrange the range (in-place), partitioning it for quicksort with SIMD.
+ *
+ * Same contract as `QuicksortPartition`. Ints in ascending order are
+ * partitioned a register at a time, with AVX-512 or else AVX2 depending on
+ * the CPU (see `VectorizedPartition`); anything else, or a CPU with neither,
+ * gets the scalar block partition. The same partition is used by the
+ * quicksort drivers when given `PartitionScheme::kVectorized`.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first             Iterator to the first item to be partitioned.
+ * @param last              Iterator after the last item to be partitioned.
+ * @param comp              Strict weak ordering of the projected items.
+ * @param proj              Projection applied to items before comparing them.
+ * @param equality_check    If true, the left partition will contain items
+ *      equivalent to the pivot. Otherwise, they will be in the right partition.
+ * @return                  Iterator to the pivot after partitioning.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt VectorizedQuicksortPartition(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const bool equality_check = true) {
+    return QuicksortPartition(
+        first, last, comp, proj, equality_check,
+        PartitionScheme::kVectorized);
+}
+
+/** Rearrange the range (in-place) into three partitions for quicksort.
+ *
+ * Uses the last item of the range as a 'pivot', and partitions the range into
+ * items less than, equivalent to and greater than the pivot (in that order).
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first  Iterator to the first item to be partitioned.
+ * @param last   Iterator after the last item to be partitioned.
+ * @param comp   Strict weak ordering of the projected items.
+ * @param proj   Projection applied to items before comparing them.
+ * @param scheme How items are moved around the pivot.
+ * @return       Pair of iterators delimiting the 'equivalent to pivot' range.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+std::pair<RandomIt, RandomIt> EqCheckQuicksortPartition(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const PartitionScheme scheme = PartitionScheme::kLomuto) {
+    RandomIt pivot_end = QuicksortPartition(
+        first, last, comp, proj, true, scheme) + 1;
+    RandomIt pivot_begin = QuicksortPartition(
+        first, pivot_end, comp, proj, false, scheme);
+    return std::make_pair(pivot_begin, pivot_end);
+}
+
+/** Rearrange the range (in-place), partitioning it randomly for quicksort.
+ *
+ * Like `QuicksortPartition`, but uses a random item of the range as the pivot.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first  Iterator to the first item to be partitioned.
+ * @param last   Iterator after the last item to be partitioned.
+ * @param comp   Strict weak ordering of the projected items.
+ * @param proj   Projection applied to items before comparing them.
+ * @param scheme How items are moved around the pivot.
+ * @return       Iterator to the pivot after partitioning.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt RandomizedQuicksortPartition(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const PartitionScheme scheme = PartitionScheme::kLomuto) {
+    RandomIt pivot = first + RandomInteger(0, (int)(last - first) - 1);
+    detail::SwapItems(last - 1, pivot);
+    return QuicksortPartition(first, last, comp, proj, true, scheme);
+}
+
+/** Rearrange the range (in-place) randomly into three partitions.
+ *
+ * Like `EqCheckQuicksortPartition`, but uses a random item of the range as the
+ * pivot.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first  Iterator to the first item to be partitioned.
+ * @param last   Iterator after the last item to be partitioned.
+ * @param comp   Strict weak ordering of the projected items.
+ * @param proj   Projection applied to items before comparing them.
+ * @param scheme How items are moved around the pivot.
+ * @return       Pair of iterators delimiting the 'equivalent to pivot' range.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+std::pair<RandomIt, RandomIt> RandomizedEqCheckQuicksortPartition(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const PartitionScheme scheme = PartitionScheme::kLomuto) {
+    RandomIt pivot = first + RandomInteger(0, (int)(last - first) - 1);
+    detail::SwapItems(last - 1, pivot);
+    return EqCheckQuicksortPartition(first, last, comp, proj, scheme);
+}
+
+/** Rearrange the range (in-place) using Hoare's partitioning algorithm.
+ *
+ * Uses the first item of the range as the pivot value. Afterwards no item up
+ * to and including the returned position is greater than the pivot, and no
+ * item after it is less than the pivot.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Iterator to the first item to be partitioned.
+ * @param last  Iterator after the last item to be partitioned.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Iterator to the last item of the left partition.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt HoareQuicksortPartition(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typename std::iterator_traits<RandomIt>::value_type pivot = *first;
+    RandomIt left = first;
+    RandomIt right = last;
+    while (true) {
+        do {
+            --right;
+        } while (detail::ProjectedLess(comp, proj, pivot, *right));
+        while (detail::ProjectedLess(comp, proj, *left, pivot))
+            ++left;
+
+        if (left < right)
+            detail::SwapItems(left++, right);
+        else
+            return right;
+    }
+}
+
+/** Sort the range (in-place) using the quicksort recursive algorithm.
+ *
+ * Worst-case performance: Theta(n^2)
+ * Average-case performance: Theta(n lg n)
+ *
+ * @param first  Iterator to the first item to be sorted.
+ * @param last   Iterator after the last item to be sorted.
+ * @param comp   Strict weak ordering of the projected items.
+ * @param proj   Projection applied to items before comparing them.
+ * @param scheme How items are moved around the pivot.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void Quicksort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const PartitionScheme scheme = PartitionScheme::kLomuto) {
+    // Terminate recursion at singletons (or short ranges, if they have a
+    // faster sort of their own)
+    if (last - first <= detail::LeafSize(first, comp, proj, 1)) {
+        detail::SortSmallRange(first, last, comp, proj);
+    }
+    else {
+        RandomIt pivot = QuicksortPartition(
+            first, last, comp, proj, true, scheme);
+        Quicksort(first, pivot, comp, proj, scheme);
+        Quicksort(pivot + 1, last, comp, proj, scheme);
+    }
+}
+
+/** Sort the range (in-place) using the randomized quicksort algorithm.
+ *
+ * Worst-case performance: Theta(n^2)
+ * Average-case performance: Theta(n lg n)
+ *
+ * @param first  Iterator to the first item to be sorted.
+ * @param last   Iterator after the last item to be sorted.
+ * @param comp   Strict weak ordering of the projected items.
+ * @param proj   Projection applied to items before comparing them.
+ * @param scheme How items are moved around the pivot.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void RandomizedQuicksort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const PartitionScheme scheme = PartitionScheme::kLomuto) {
+    // Terminate recursion at singletons (or short ranges, if they have a
+    // faster sort of their own)
+    if (last - first <= detail::LeafSize(first, comp, proj, 1)) {
+        detail::SortSmallRange(first, last, comp, proj);
+    }
+    else {
+        RandomIt pivot = RandomizedQuicksortPartition(
+            first, last, comp, proj, scheme);
+        RandomizedQuicksort(first, pivot, comp, proj, scheme);
+        RandomizedQuicksort(pivot + 1, last, comp, proj, scheme);
+    }
+}
+
+/** Sort the range (in-place) using the randomized equality-checking quicksort.
+ *
+ * Worst-case performance: Theta(n^2)
+ * Average-case performance: Theta(n lg n)
+ *
+ * @param first  Iterator to the first item to be sorted.
+ * @param last   Iterator after the last item to be sorted.
+ * @param comp   Strict weak ordering of the projected items.
+ * @param proj   Projection applied to items before comparing them.
+ * @param scheme How items are moved around the pivot.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void RandomizedEqCheckQuicksort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const PartitionScheme scheme = PartitionScheme::kLomuto) {
+    // Terminate recursion at singletons (or short ranges, if they have a
+    // faster sort of their own)
+    if (last - first <= detail::LeafSize(first, comp, proj, 1)) {
+        detail::SortSmallRange(first, last, comp, proj);
+    }
+    else {
+        auto pivot = RandomizedEqCheckQuicksortPartition(
+            first, last, comp, proj, scheme);
+        RandomizedEqCheckQuicksort(first, pivot.first, comp, proj, scheme);
+        RandomizedEqCheckQuicksort(pivot.second, last, comp, proj, scheme);
+    }
+}
+
+/** Sort the range (in-place) using the Hoare quicksort recursive algorithm.
+ *
+ * Worst-case performance: Theta(n^2)
+ * Average-case performance: Theta(n lg n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void HoareQuicksort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    // Terminate recursion at singletons (or short ranges, if they have a
+    // faster sort of their own)
+    if (last - first <= detail::LeafSize(first, comp, proj, 1)) {
+        detail::SortSmallRange(first, last, comp, proj);
+    }
+    else {
+        RandomIt pivot = HoareQuicksortPartition(first, last, comp, proj);
+        HoareQuicksort(first, pivot + 1, comp, proj);
+        HoareQuicksort(pivot + 1, last, comp, proj);
+    }
+}
+
+/** Ranges at most this long are insertion-sorted by `IntroSort`.
+ */
+const int kIntroSortInsertionCutoff = 16;
+
+/** Ranges longer than this get a ninther (rather than median-of-three) pivot.
+ */
+const int kIntroSortNintherThreshold = 128;
+
+namespace detail {
+
+/** Sort three items (in-place), so the median ends up in the middle one.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void SortThreeItems(
+        RandomIt a, RandomIt b, RandomIt c, Compare &comp, Projection &proj) {
+    if (ProjectedLess(comp, proj, *b, *a))
+        SwapItems(a, b);
+    if (ProjectedLess(comp, proj, *c, *b)) {
+        SwapItems(b, c);
+        if (ProjectedLess(comp, proj, *b, *a))
+            SwapItems(a, b);
+    }
+}
+
+/** Move a median-of-three (or, for long ranges, ninther) pivot to the front.
+ *
+ * The ninther is the median of the medians of three groups of three items,
+ * spread over the start, middle and end of the range. Both choices keep
+ * sorted, reversed and organ-pipe inputs from producing lopsided partitions.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void MoveIntroSortPivotToFirst(
+        RandomIt first, RandomIt last, Compare &comp, Projection &proj) {
+    auto size = last - first;
+    RandomIt middle = first + size / 2;
+    if (size > kIntroSortNintherThreshold) {
+        SortThreeItems(first, middle, last - 1, comp, proj);
+        SortThreeItems(first + 1, middle - 1, last - 2, comp, proj);
+        SortThreeItems(first + 2, middle + 1, last - 3, comp, proj);
+        SortThreeItems(middle - 1, middle, middle + 1, comp, proj);
+        SwapItems(first, middle);
+    }
+    else {
+        SortThreeItems(middle, first, last - 1, comp, proj);
+    }
+}
+
+/** Introsort the range, falling back to heapsort after `depth_limit` splits.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void IntroSortLoop(
+        RandomIt first, RandomIt last, int depth_limit,
+        Compare &comp, Projection &proj) {
+    const int leaf_size = LeafSize(
+        first, comp, proj, kIntroSortInsertionCutoff);
+    while (last - first > leaf_size) {
+        if (depth_limit == 0) {
+            HeapSort(first, last, comp, proj);
+            return;
+        }
+        --depth_limit;
+
+        MoveIntroSortPivotToFirst(first, last, comp, proj);
+        RandomIt split = HoareQuicksortPartition(first, last, comp, proj) + 1;
+
+        // Recurse into the smaller side and loop on the larger one, so the
+        // stack never holds more than lg n frames
+        if (split - first < last - split) {
+            IntroSortLoop(first, split, depth_limit, comp, proj);
+            first = split;
+        }
+        else {
+            IntroSortLoop(split, last, depth_limit, comp, proj);
+            last = split;
+        }
+    }
+    SortSmallRange(first, last, comp, proj);
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) using the introsort hybrid algorithm.
+ *
+ * Quicksort with Hoare partitioning around a median-of-three or ninther pivot,
+ * which switches to insertion sort (sorting networks, for ints in ascending
+ * order) for short ranges and to heapsort once the recursion gets deeper than
+ * 2 lg n (so adversarial inputs can't make it quadratic). Only the smaller
+ * side of each partition is recursed into, so the stack depth is O(lg n).
+ *
+ * Worst-case performance: Theta(n lg n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void IntroSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    int depth_limit = 0;
+    for (auto size = last - first; size > 1; size /= 2)
+        depth_limit += 2;
+    detail::IntroSortLoop(first, last, depth_limit, comp, proj);
+}
+
+/** Rearrange the range (in-place) into three partitions, in a single pass.
+ *
+ * Uses the first item of the range as the pivot, and partitions the range
+ * into items less than, equivalent to and greater than it (in that order),
+ * with Bentley and McIlroy's scheme: a Hoare-style scan from both ends that
+ * swaps items equivalent to the pivot out to the ends of the range as it
+ * meets them, and then swaps the two runs of them into the middle. Unlike
+ * `EqCheckQuicksortPartition`, the range is only scanned once.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Iterator to the first item to be partitioned.
+ * @param last  Iterator after the last item to be partitioned.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Pair of iterators delimiting the 'equivalent to pivot' range.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+std::pair<RandomIt, RandomIt> ThreeWayQuicksortPartition(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    if (last - first < 2)
+        return std::make_pair(first, last);
+    typename std::iterator_traits<RandomIt>::value_type pivot = *first;
+    const Index hi = (last - first) - 1;
+    // Items equivalent to the pivot are kept in [0, p] and [q, hi] until
+    // the scan is over
+    Index i = 0, j = hi + 1;
+    Index p = 0, q = hi + 1;
+    while (true) {
+        while (detail::ProjectedLess(comp, proj, first[++i], pivot))
+            if (i == hi)
+                break;
+        // The pivot at index 0 stops this scan
+        while (detail::ProjectedLess(comp, proj, pivot, first[--j])) {}
+
+        if (i == j && !detail::ProjectedLess(comp, proj, first[i], pivot) &&
+                !detail::ProjectedLess(comp, proj, pivot, first[i]))
+            detail::SwapItems(first + ++p, first + i);
+        if (i >= j)
+            break;
+        detail::SwapItems(first + i, first + j);
+        // Both scans stopped at items that could be equivalent to the pivot;
+        // one comparison tells each of them after the swap
+        if (!detail::ProjectedLess(comp, proj, first[i], pivot))
+            detail::SwapItems(first + ++p, first + i);
+        if (!detail::ProjectedLess(comp, proj, pivot, first[j]))
+            detail::SwapItems(first + --q, first + j);
+    }
+
+    i = j + 1;
+    for (Index k = 0; k <= p; ++k)
+        detail::SwapItems(first + k, first + j--);
+    for (Index k = hi; k >= q; --k)
+        detail::SwapItems(first + k, first + i++);
+    return std::make_pair(first + (j + 1), first + i);
+}
+
+namespace detail {
+
+/** Three-way quicksort the range, falling back to heapsort after
+ * `depth_limit` splits.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void ThreeWayQuicksortLoop(
+        RandomIt first, RandomIt last, int depth_limit,
+        Compare &comp, Projection &proj) {
+    const int leaf_size = LeafSize(
+        first, comp, proj, kIntroSortInsertionCutoff);
+    while (last - first > leaf_size) {
+        if (depth_limit == 0) {
+            HeapSort(first, last, comp, proj);
+            return;
+        }
+        --depth_limit;
+
+        MoveIntroSortPivotToFirst(first, last, comp, proj);
+        auto pivot = ThreeWayQuicksortPartition(first, last, comp, proj);
+
+        // Recurse into the smaller side and loop on the larger one
+        if (pivot.first - first < last - pivot.second) {
+            ThreeWayQuicksortLoop(first, pivot.first, depth_limit, comp, proj);
+            first = pivot.second;
+        }
+        else {
+            ThreeWayQuicksortLoop(pivot.second, last, depth_limit, comp, proj);
+            last = pivot.first;
+        }
+    }
+    SortSmallRange(first, last, comp, proj);
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) using three-way (Bentley–McIlroy) quicksort.
+ *
+ * Like `IntroSort`, but each level partitions the range into items less
+ * than, equivalent to and greater than the pivot, in one pass (see
+ * `ThreeWayQuicksortPartition`), and never looks at the equivalent ones
+ * again. With few distinct keys, every key is a pivot after about lg d
+ * levels, so sorting n items with d distinct keys takes O(n lg d) time
+ * rather than the O(n lg n) (or worse) of the two-way quicksorts.
+ *
+ * Worst-case performance: Theta(n lg n)
+ *
+ * @param first Iterator to the first item to be sorted.
+ * @param last  Iterator after the last item to be sorted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void ThreeWayQuicksort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    int depth_limit = 0;
+    for (auto size = last - first; size > 1; size /= 2)
+        depth_limit += 2;
+    detail::ThreeWayQuicksortLoop(first, last, depth_limit, comp, proj);
+}
+
+namespace detail {
+
+/** Copy each item to the next free output slot for its key, in input order.
+ *
+ * This is the scatter pass of counting sort (and of each radix sort pass);
+ * pass move iterators to move the items instead.
+ *
+ * @param first     Iterator to the first item to be copied.
+ * @param last      Iterator after the last item to be copied.
+ * @param output    Iterator to the start of the output range.
+ * @param offsets   Output index of the first item with each key; advanced
+ *      past the items as they are copied.
+ * @param key       Function giving the (small, non-negative) key of an item.
+ */
+template <typename ForwardIt, typename RandomOutputIt, typename KeyFunction>
+void StableScatterByKey(
+        ForwardIt first, ForwardIt last, RandomOutputIt output,
+        std::size_t *offsets, KeyFunction key) {
+    for (ForwardIt item = first; item != last; ++item) {
+        output[offsets[key(*item)]++] = *item;
+        COUNT_MOVES(1);
+    }
+}
+
+/** Turn key counts into the output index of the first item with each key.
+ *
+ * @param counts        Number of items with each key; overwritten.
+ * @param num_keys      Number of keys.
+ */
+inline void CountsToOffsets(std::size_t *counts, const std::size_t num_keys) {
+    std::size_t offset = 0;
+    for (std::size_t key = 0; key < num_keys; ++key) {
+        std::size_t count = counts[key];
+        counts[key] = offset;
+        offset += count;
+    }
+}
+
+/** Key function giving an item's projected key less `min` (its counting
+ * sort bucket).
+ *
+ * It takes whatever the iterators yield, so a proxy is projected as it is
+ * rather than converted to an item (which would copy it).
+ */
+template <typename Projection>
+struct OffsetKey {
+    Projection &proj;
+    long long min;
+
+    template <typename Item>
+    std::size_t operator()(const Item &item) const {
+        return (std::size_t)(proj(item) - min);
+    }
+};
+
+} // namespace detail
+
+/** Write a sorted copy of the range using the counting sort algorithm.
+ *
+ * The items are ordered by their projected integer keys, which must lie in
+ * `[min, max]`. The sort is stable.
+ *
+ * Worst-case performance: Theta(n + max - min)
+ *
+ * @param first     Iterator to the first item to be sorted.
+ * @param last      Iterator after the last item to be sorted.
+ * @param output    Iterator to the start of the output range.
+ * @param min       Smallest key in the input range.
+ * @param max       Largest key in the input range.
+ * @param proj      Projection giving the integer key of an item.
+ */
+template <typename ForwardIt, typename RandomOutputIt,
+          typename Projection = Identity>
+void CountingSort(
+        ForwardIt first, ForwardIt last, RandomOutputIt output,
+        const long long min, const long long max,
+        Projection proj = Projection()) {
+    // The item at index 0 is the number of times the min key shows up in the
+    // input, the item at index 1 the number of times min + 1 shows up, and so
+    // on up to the max key
+    std::vector<std::size_t> key_counts(max - min + 1, 0);
+    for (ForwardIt item = first; item != last; ++item)
+        ++key_counts[proj(*item) - min];
+
+    // Scattering in input order keeps equal keys in their original order
+    detail::CountsToOffsets(key_counts.data(), key_counts.size());
+    detail::OffsetKey<Projection> key = {proj, min};
+    detail::StableScatterByKey(first, last, output, key_counts.data(), key);
+}
+
+#endif //ALGORITHMS_STUDY_CPP_GENERIC_SORT_HPP
@@ -1,4 +1,7 @@
 /** Functions for binary heaps.
+ *
+ * Generic versions of the heapify and heap-building functions, over any
+ * random-access range, comparator and projection, are in `generic_heap.hpp`.
  */
 
 #ifndef ALGORITHMS_STUDY_CPP_HEAP_HPP
@@ -6,6 +9,8 @@
 
 #include <vector>
 
+#include "algorithm/vector/generic_heap.hpp"
+
 
 /** Return index of left child of the node in a binary heap.
  *
@@ -0,0 +1,201 @@
+/** Merging any number of sorted runs in one pass.
+ *
+ * A run is a pair of input iterators, so runs can be parts of vectors, other
+ * containers or streams (e.g. `std::istream_iterator`). The merge repeatedly
+ * outputs the first item of the run whose first item is smallest; that run
+ * is found with a `LoserTree` or, alternatively, a binary min-heap of the
+ * runs. Either way every run is only ever read at its front, and each output
+ * item costs about lg k comparisons.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_KWAY_MERGE_HPP
+#define ALGORITHMS_STUDY_CPP_KWAY_MERGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "algorithm/counters.hpp"
+#include "algorithm/vector/generic_heap.hpp"
+#include "algorithm/vector/loser_tree.hpp"
+
+
+/** How `MultiwayMerge` finds the run with the smallest first item.
+ */
+enum class MergeStrategy {
+    /// A loser tree: one comparison per level to replace the winner.
+    kLoserTree,
+    /// A binary min-heap of the runs (`MinHeapify` after each item): up to two
+    /// comparisons per level, but runs that run out leave the heap, so it
+    /// gets shallower when a few runs are much longer than the rest.
+    kHeap
+};
+
+namespace detail {
+
+/** Orders iterators by the projected items they point to.
+ */
+template <typename Compare, typename Projection>
+struct DereferencingLess {
+    Compare comp;
+    Projection proj;
+
+    template <typename InputIt>
+    bool operator()(const InputIt &a, const InputIt &b) {
+        return ProjectedLess(comp, proj, *a, *b);
+    }
+};
+
+/** The current position of a run being merged from a heap.
+ */
+template <typename InputIt>
+struct MergeCursor {
+    InputIt next;
+    InputIt last;
+    int run;
+};
+
+/** Orders cursors by their current items, and ties by run (for stability).
+ *
+ * The heap functions count the comparisons of cursors, so this doesn't.
+ */
+template <typename Compare, typename Projection>
+struct MergeCursorLess {
+    Compare comp;
+    Projection proj;
+
+    template <typename InputIt>
+    bool operator()(
+            const MergeCursor<InputIt> &a, const MergeCursor<InputIt> &b) {
+        if (comp(proj(*a.next), proj(*b.next)))
+            return true;
+        return a.run < b.run && !comp(proj(*b.next), proj(*a.next));
+    }
+};
+
+template <typename InputIt, typename OutputIt, typename Compare,
+          typename Projection>
+OutputIt LoserTreeMerge(
+        const std::vector<std::pair<InputIt, InputIt>> &runs,
+        OutputIt output, Compare &comp, Projection &proj) {
+    int num_runs = (int)runs.size();
+    DereferencingLess<Compare, Projection> less = {comp, proj};
+    LoserTree<InputIt, DereferencingLess<Compare, Projection>> tree(
+        num_runs, less);
+    for (int run = 0; run < num_runs; ++run)
+        if (runs[run].first != runs[run].second)
+            tree.SetKey(run, runs[run].first);
+    tree.Build();
+
+    while (!tree.Empty()) {
+        int run = tree.Winner();
+        InputIt next = tree.WinnerKey();
+        *output = *next;
+        ++output;
+        COUNT_MOVES(1);
+        if (++next != runs[run].second)
+            tree.ReplaceWinner(next);
+        else
+            tree.RemoveWinner();
+    }
+    return output;
+}
+
+template <typename InputIt, typename OutputIt, typename Compare,
+          typename Projection>
+OutputIt HeapMerge(
+        const std::vector<std::pair<InputIt, InputIt>> &runs,
+        OutputIt output, Compare &comp, Projection &proj) {
+    std::vector<MergeCursor<InputIt>> heap;
+    for (int run = 0; run < (int)runs.size(); ++run)
+        if (runs[run].first != runs[run].second) {
+            MergeCursor<InputIt> cursor = {
+                runs[run].first, runs[run].second, run};
+            heap.push_back(cursor);
+        }
+    MergeCursorLess<Compare, Projection> less = {comp, proj};
+    MinHeapBuilder(heap.begin(), heap.end(), less);
+
+    std::ptrdiff_t heap_order = heap.size();
+    while (heap_order > 0) {
+        MergeCursor<InputIt> &top = heap[0];
+        *output = *top.next;
+        ++output;
+        COUNT_MOVES(1);
+        // An exhausted run is replaced by the last leaf of the heap
+        if (++top.next == top.last)
+            top = heap[--heap_order];
+        MinHeapify(heap.begin(), 0, heap_order, less);
+    }
+    return output;
+}
+
+} // namespace detail
+
+/** Merge sorted runs into one sorted sequence, in one pass.
+ *
+ * The merge is stable: equivalent items come out in the order of their runs
+ * (and within a run, in their original order). The output must not overlap
+ * any of the runs. Pass move iterators to move the items rather than copy
+ * them.
+ *
+ * Worst-case performance: Theta(n lg k), for n items in k runs
+ *
+ * @param runs      The runs, as (first, last) iterator pairs; each must be
+ *      sorted.
+ * @param output    Iterator to the start of the output range.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ * @param strategy  How the next item is picked.
+ * @return          Iterator after the last item written.
+ */
+template <typename InputIt, typename OutputIt, typename Compare = Less,
+          typename Projection = Identity>
+OutputIt MultiwayMerge(
+        const std::vector<std::pair<InputIt, InputIt>> &runs,
+        OutputIt output,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const MergeStrategy strategy = MergeStrategy::kLoserTree) {
+    if (runs.empty())
+        return output;
+    if (runs.size() == 1)
+        return std::copy(runs[0].first, runs[0].second, output);
+    if (strategy == MergeStrategy::kHeap)
+        return detail::HeapMerge(runs, output, comp, proj);
+    return detail::LoserTreeMerge(runs, output, comp, proj);
+}
+
+/** Merge sorted vectors into a new sorted vector.
+ *
+ * Like `MultiwayMerge`, for the common case of runs held in vectors.
+ *
+ * Worst-case performance: Theta(n lg k), for n items in k vectors
+ *
+ * @param runs      The vectors; each must be sorted.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ * @param strategy  How the next item is picked.
+ * @return          All the items of the vectors, in sorted order.
+ */
+template <typename T, typename Compare = Less, typename Projection = Identity>
+std::vector<T> MergeSortedVectors(
+        const std::vector<std::vector<T>> &runs,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const MergeStrategy strategy = MergeStrategy::kLoserTree) {
+    typedef typename std::vector<T>::const_iterator RunIt;
+    std::vector<std::pair<RunIt, RunIt>> ranges;
+    std::size_t total_size = 0;
+    for (const std::vector<T> &run : runs) {
+        ranges.push_back(std::make_pair(run.begin(), run.end()));
+        total_size += run.size();
+    }
+    std::vector<T> merged;
+    merged.reserve(total_size);
+    MultiwayMerge(
+        ranges, std::back_inserter(merged), comp, proj, strategy);
+    return merged;
+}
+
+#endif //ALGORITHMS_STUDY_CPP_KWAY_MERGE_HPP
@@ -0,0 +1,135 @@
+/** Tournament ("loser") tree for merging several sorted sources.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_LOSER_TREE_HPP
+#define ALGORITHMS_STUDY_CPP_LOSER_TREE_HPP
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "algorithm/vector/generic_heap.hpp"
+
+
+/** A loser tree over the current keys of `k` sources.
+ *
+ * Each source has a leaf holding its current key (or nothing, once the
+ * source is exhausted). Every internal node remembers the loser of the match
+ * played there, and the overall winner is kept separately, so replacing the
+ * winner's key only replays the matches on the path from its leaf to the
+ * root: one comparison per level, lg k in all, with no sibling to look at
+ * (which is what makes it cheaper than a binary heap for merging).
+ *
+ * Ties go to the source with the lower index, so merging runs taken from
+ * left to right is stable.
+ *
+ * Usage: `SetKey` (or `SetExhausted`) every source, `Build`, and then
+ * repeatedly take `WinnerKey` and `ReplaceWinner` / `RemoveWinner` until
+ * `Empty`.
+ */
+template <typename Key, typename Compare = Less>
+class LoserTree {
+public:
+    /** Create a tree over `num_sources` (at least one) exhausted sources.
+     *
+     * @param num_sources   Number of sources.
+     * @param comp          Strict weak ordering of the keys.
+     */
+    explicit LoserTree(const int num_sources, Compare comp = Compare())
+        : keys_(num_sources), exhausted_(num_sources, true),
+          losers_(num_sources), winner_(0), comp_(comp) {
+        assert(num_sources > 0);
+    }
+
+    /** Number of sources. */
+    int NumSources() const { return (int)keys_.size(); }
+
+    /** Set a source's current key (before `Build`). */
+    void SetKey(const int source, const Key &key) {
+        keys_[source] = key;
+        exhausted_[source] = false;
+    }
+
+    /** Mark a source as having no keys (before `Build`). */
+    void SetExhausted(const int source) {
+        exhausted_[source] = true;
+    }
+
+    /** Play all the matches, after the sources' keys have been set. */
+    void Build() {
+        winner_ = BuildSubtree(1);
+    }
+
+    /** Whether every source is exhausted. */
+    bool Empty() const { return exhausted_[winner_]; }
+
+    /** Source with the smallest current key. */
+    int Winner() const { return winner_; }
+
+    /** Smallest current key (the tree must not be empty). */
+    const Key &WinnerKey() const { return keys_[winner_]; }
+
+    /** Replace the winner's key with the next key of the same source. */
+    void ReplaceWinner(const Key &key) {
+        keys_[winner_] = key;
+        Replay();
+    }
+
+    /** Mark the winner's source as exhausted. */
+    void RemoveWinner() {
+        exhausted_[winner_] = true;
+        Replay();
+    }
+
+private:
+    /** Whether source `a`'s key goes before source `b`'s. */
+    bool Beats(const int a, const int b) {
+        if (exhausted_[a] || exhausted_[b])
+            return !exhausted_[a] && (exhausted_[b] || a < b);
+        // One comparison settles it, as ties go to the lower index
+        if (a < b)
+            return !comp_(keys_[b], keys_[a]);
+        return comp_(keys_[a], keys_[b]);
+    }
+
+    /** Play the matches below `node`, returning the winner.
+     *
+     * Nodes are numbered like a binary heap: node 1 is the root, node n has
+     * children 2n and 2n + 1, and source s is the leaf at node k + s.
+     */
+    int BuildSubtree(const int node) {
+        int num_sources = NumSources();
+        if (node >= num_sources)
+            return node - num_sources;
+        int left = BuildSubtree(2 * node);
+        int right = BuildSubtree(2 * node + 1);
+        if (Beats(left, right)) {
+            losers_[node] = right;
+            return left;
+        }
+        losers_[node] = left;
+        return right;
+    }
+
+    /** Replay the matches from the winner's leaf up to the root. */
+    void Replay() {
+        int winner = winner_;
+        for (int node = (winner + NumSources()) / 2; node > 0; node /= 2) {
+            // Selects rather than branches: the outcome is unpredictable
+            int loser = losers_[node];
+            bool loser_wins = Beats(loser, winner);
+            losers_[node] = loser_wins ? winner : loser;
+            winner = loser_wins ? loser : winner;
+        }
+        winner_ = winner;
+    }
+
+    std::vector<Key> keys_;
+    std::vector<char> exhausted_;
+    // Loser of the match at each internal node; index 0 is unused
+    std::vector<int> losers_;
+    int winner_;
+    Compare comp_;
+};
+
+#endif //ALGORITHMS_STUDY_CPP_LOSER_TREE_HPP
@@ -0,0 +1,266 @@
+/** Maximum subarray (the contiguous run of items with the largest sum), in
+ * parallel and over streams.
+ *
+ * Kadane's algorithm is a left-to-right scan, but the problem also splits: a
+ * segment is summarized by its total, its best prefix, its best suffix and
+ * its best subarray, and the summary of two adjacent segments follows from
+ * theirs (the best subarray of both is the best of either, or the left's best
+ * suffix followed by the right's best prefix). Combining summaries is
+ * associative, so segments can be summarized on separate threads and combined
+ * in a tree, as a segment tree does; and a stream can be summarized an item
+ * at a time, in constant space.
+ *
+ * Subarrays are nonempty, so the best one of all-negative items is the
+ * largest item. Of the subarrays with the largest sum, the one beginning
+ * first (and of those, ending first) is chosen, however the items were split.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_MAX_SUBARRAY_HPP
+#define ALGORITHMS_STUDY_CPP_MAX_SUBARRAY_HPP
+
+#include <cstddef>
+
+#include "algorithm/parallel/thread_pool.hpp"
+
+
+/** Segments of at most this many items are summarized sequentially, by
+ * default.
+ *
+ * Summarizing is a few operations per item, so it takes a long segment to
+ * pay for a task.
+ */
+const int kMaxSubarrayGrainSize = 1 << 16;
+
+/** Summary of a segment, from which the maximum subarray of it and of any
+ * segments it is combined with can be found.
+ *
+ * Positions are offsets from the segment's first item.
+ */
+template <typename Sum = long long>
+struct SubarraySummary {
+    std::size_t size;           ///< Number of items (0 for no items).
+    Sum total;                  ///< Sum of all the items.
+    Sum prefix;                 ///< Largest sum of a prefix (the shortest)...
+    std::size_t prefix_end;     ///< ...which is `[0, prefix_end)`.
+    Sum suffix;                 ///< Largest sum of a suffix (the longest)...
+    std::size_t suffix_begin;   ///< ...which is `[suffix_begin, size)`.
+    Sum best;                   ///< Largest sum of a subarray...
+    std::size_t best_begin;     ///< ...which is `[best_begin, best_end)`.
+    std::size_t best_end;
+};
+
+namespace detail {
+
+/** Whether `[begin, end)`, with the given sum, beats the summary's best
+ * subarray.
+ */
+template <typename Sum>
+bool IsBetterSubarray(
+        const SubarraySummary<Sum> &summary, const Sum &sum,
+        const std::size_t begin, const std::size_t end) {
+    if (summary.best < sum)
+        return true;
+    if (sum < summary.best)
+        return false;
+    return begin < summary.best_begin ||
+           (begin == summary.best_begin && end < summary.best_end);
+}
+
+} // namespace detail
+
+/** Return the summary of two adjacent segments, from theirs.
+ *
+ * Worst-case performance: Theta(1)
+ *
+ * @param left  Summary of the first segment.
+ * @param right Summary of the segment right after it.
+ * @return      Summary of both segments together.
+ */
+template <typename Sum>
+SubarraySummary<Sum> CombineSubarraySummaries(
+        const SubarraySummary<Sum> &left, const SubarraySummary<Sum> &right) {
+    if (left.size == 0)
+        return right;
+    if (right.size == 0)
+        return left;
+
+    SubarraySummary<Sum> both;
+    std::size_t offset = left.size;
+    both.size = left.size + right.size;
+    both.total = left.total + right.total;
+
+    Sum long_prefix = left.total + right.prefix;
+    if (left.prefix < long_prefix) {
+        both.prefix = long_prefix;
+        both.prefix_end = offset + right.prefix_end;
+    }
+    else {
+        both.prefix = left.prefix;
+        both.prefix_end = left.prefix_end;
+    }
+    Sum long_suffix = left.suffix + right.total;
+    if (long_suffix < right.suffix) {
+        both.suffix = right.suffix;
+        both.suffix_begin = offset + right.suffix_begin;
+    }
+    else {
+        both.suffix = long_suffix;
+        both.suffix_begin = left.suffix_begin;
+    }
+
+    // The left's best subarray begins first, then the one crossing over;
+    // the right's only wins with a larger sum
+    both.best = left.best;
+    both.best_begin = left.best_begin;
+    both.best_end = left.best_end;
+    Sum crossing = left.suffix + right.prefix;
+    std::size_t crossing_end = offset + right.prefix_end;
+    if (detail::IsBetterSubarray(
+            both, crossing, left.suffix_begin, crossing_end)) {
+        both.best = crossing;
+        both.best_begin = left.suffix_begin;
+        both.best_end = crossing_end;
+    }
+    if (both.best < right.best) {
+        both.best = right.best;
+        both.best_begin = offset + right.best_begin;
+        both.best_end = offset + right.best_end;
+    }
+    return both;
+}
+
+/** Maximum subarray of a stream of items, kept up to date as they arrive.
+ *
+ * Only the summary of the items so far is kept, so the items need not be:
+ * each one is folded in as by Kadane's algorithm (the best suffix is the
+ * best subarray ending at the latest item). Summaries of separate streams
+ * can be combined with `CombineSubarraySummaries`.
+ *
+ * Space: Theta(1)
+ */
+template <typename Sum = long long>
+class StreamingMaxSubarray {
+public:
+    StreamingMaxSubarray() : summary_() {}
+
+    /** Fold in the next item of the stream.
+     *
+     * Worst-case performance: Theta(1)
+     *
+     * @param value The item.
+     */
+    void Push(const Sum &value) {
+        std::size_t index = summary_.size++;
+        if (index == 0) {
+            summary_.total = summary_.prefix = summary_.suffix =
+                summary_.best = value;
+            summary_.prefix_end = summary_.best_end = 1;
+            summary_.suffix_begin = summary_.best_begin = 0;
+            return;
+        }
+        summary_.total = summary_.total + value;
+        if (summary_.prefix < summary_.total) {
+            summary_.prefix = summary_.total;
+            summary_.prefix_end = index + 1;
+        }
+        // A negative best suffix would only lower the sum of the new one
+        if (summary_.suffix < Sum()) {
+            summary_.suffix = value;
+            summary_.suffix_begin = index;
+        }
+        else {
+            summary_.suffix = summary_.suffix + value;
+        }
+        if (detail::IsBetterSubarray(
+                summary_, summary_.suffix, summary_.suffix_begin, index + 1)) {
+            summary_.best = summary_.suffix;
+            summary_.best_begin = summary_.suffix_begin;
+            summary_.best_end = index + 1;
+        }
+    }
+
+    /** Fold in the next items of the stream, in order.
+     *
+     * Worst-case performance: Theta(n)
+     *
+     * @param first Iterator to the first item.
+     * @param last  Iterator after the last item.
+     */
+    template <typename InputIt>
+    void Push(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            Push(*first);
+    }
+
+    /** Summary of the items so far; its best subarray is the answer. */
+    const SubarraySummary<Sum> &summary() const { return summary_; }
+
+private:
+    SubarraySummary<Sum> summary_;
+};
+
+/** Return the summary of the range, whose best subarray is its maximum
+ * subarray.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param last  Iterator after the last item of the range.
+ * @return      Summary of the range, with sums of type `Sum`.
+ */
+template <typename Sum = long long, typename InputIt>
+SubarraySummary<Sum> SummarizeSubarrays(InputIt first, InputIt last) {
+    StreamingMaxSubarray<Sum> stream;
+    stream.Push(first, last);
+    return stream.summary();
+}
+
+namespace detail {
+
+/** Parallel version of `SummarizeSubarrays`. */
+template <typename Sum, typename RandomIt>
+SubarraySummary<Sum> ParallelSummarizeSubarraysRecursive(
+        RandomIt first, RandomIt last, ThreadPool &pool,
+        const int grain_size) {
+    if (last - first <= grain_size)
+        return SummarizeSubarrays<Sum>(first, last);
+
+    RandomIt middle = first + (last - first) / 2;
+    SubarraySummary<Sum> left = SubarraySummary<Sum>();
+    TaskGroup group(pool);
+    group.Run([=, &pool, &left]() {
+        left = ParallelSummarizeSubarraysRecursive<Sum>(
+            first, middle, pool, grain_size);
+    });
+    SubarraySummary<Sum> right = ParallelSummarizeSubarraysRecursive<Sum>(
+        middle, last, pool, grain_size);
+    group.Wait();
+    return CombineSubarraySummaries(left, right);
+}
+
+} // namespace detail
+
+/** Return the summary of the range, summarizing its pieces in parallel.
+ *
+ * The two halves of each range are summarized as parallel tasks, and their
+ * summaries combined; ranges of at most `grain_size` items are summarized
+ * sequentially. The result is the same as `SummarizeSubarrays`'s.
+ *
+ * Worst-case performance: Theta(n) work, O(grain_size + lg n) span
+ *
+ * @param first         Iterator to the first item of the range.
+ * @param last          Iterator after the last item of the range.
+ * @param pool          Pool to run on.
+ * @param grain_size    Ranges of at most this many items are summarized
+ *      sequentially.
+ * @return              Summary of the range, with sums of type `Sum`.
+ */
+template <typename Sum = long long, typename RandomIt>
+SubarraySummary<Sum> ParallelSummarizeSubarrays(
+        RandomIt first, RandomIt last, ThreadPool &pool,
+        const int grain_size = kMaxSubarrayGrainSize) {
+    return detail::ParallelSummarizeSubarraysRecursive<Sum>(
+        first, last, pool, grain_size < 1 ? 1 : grain_size);
+}
+
+#endif //ALGORITHMS_STUDY_CPP_MAX_SUBARRAY_HPP
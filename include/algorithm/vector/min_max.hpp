@@ -0,0 +1,62 @@
+/** Smallest and largest items of a range, found together.
+ *
+ * Finding the minimum and then the maximum takes 2n - 2 comparisons and two
+ * passes over the range. Taking the items in pairs, and comparing only the
+ * smaller of each pair with the minimum and the larger with the maximum,
+ * takes about 1.5 n comparisons and one pass.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_MIN_MAX_HPP
+#define ALGORITHMS_STUDY_CPP_MIN_MAX_HPP
+
+#include <utility>
+
+#include "algorithm/vector/generic_heap.hpp"
+
+
+/** Return the smallest and the largest items of the range.
+ *
+ * Like `std::minmax_element`, it returns the first of the smallest items
+ * and the last of the largest ones.
+ *
+ * Worst-case performance: Theta(n), with fewer than 1.5 n comparisons
+ *
+ * @param first Iterator to the first item of the range.
+ * @param last  Iterator after the last item of the range.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Pair of iterators to the smallest and the largest items (both
+ *      `last` if the range is empty).
+ */
+template <typename ForwardIt, typename Compare = Less,
+          typename Projection = Identity>
+std::pair<ForwardIt, ForwardIt> MinMaxElement(
+        ForwardIt first, ForwardIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    std::pair<ForwardIt, ForwardIt> extremes(first, first);
+    if (first == last)
+        return extremes;
+
+    ++first;
+    while (first != last) {
+        ForwardIt smaller = first;
+        ForwardIt larger = first;
+        if (++first != last) {
+            // Of two equivalent items, the first is the smaller and the
+            // second the larger, which keeps the first minimum and the last
+            // maximum
+            if (detail::ProjectedLess(comp, proj, *first, *smaller))
+                smaller = first;
+            else
+                larger = first;
+            ++first;
+        }
+        if (detail::ProjectedLess(comp, proj, *smaller, *extremes.first))
+            extremes.first = smaller;
+        if (!detail::ProjectedLess(comp, proj, *larger, *extremes.second))
+            extremes.second = larger;
+    }
+    return extremes;
+}
+
+#endif //ALGORITHMS_STUDY_CPP_MIN_MAX_HPP
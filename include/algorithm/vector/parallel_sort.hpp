@@ -0,0 +1,552 @@
+/** Parallel sorting functions.
+ *
+ * These run on a work-stealing `ThreadPool`: recursive halves are forked as
+ * tasks, and below a tunable grain size the sequential algorithms from
+ * `generic_sort.hpp` take over. The templates take the pool to run on, so one
+ * pool can be reused across many sorts; the `std::vector<int>` functions take a
+ * thread count and start a pool of their own.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_PARALLEL_SORT_HPP
+#define ALGORITHMS_STUDY_CPP_PARALLEL_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/vector/generic_sort.hpp"
+
+
+/** Subranges at most this long are sorted sequentially, by default.
+ */
+const int kDefaultParallelGrainSize = 1 << 14;
+
+/** Stably merge two sorted ranges into an output range, in parallel.
+ *
+ * The larger range is split at its midpoint, and the matching split point
+ * ("co-rank") of the other range is found by binary search; the two halves of
+ * the output are then independent and are merged as separate tasks.
+ *
+ * Worst-case performance: Theta(n) work, O(log^2 n) span
+ *
+ * @param first1        Iterator to the first item of the first range.
+ * @param last1         Iterator after the last item of the first range.
+ * @param first2        Iterator to the first item of the second range.
+ * @param last2         Iterator after the last item of the second range.
+ * @param output        Iterator to the start of the output range, which must
+ *      not overlap either input.
+ * @param pool          Pool to run the merge on.
+ * @param grain_size    Merges of at most this many items are done serially.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename InputIt1, typename InputIt2, typename OutputIt,
+          typename Compare = Less, typename Projection = Identity>
+void ParallelMergeSortedRanges(
+        InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+        OutputIt output, ThreadPool &pool,
+        const int grain_size = kDefaultParallelGrainSize,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto size1 = last1 - first1;
+    auto size2 = last2 - first2;
+    // Splitting always makes progress once both halves can be nonempty
+    if (size1 + size2 <= std::max(grain_size, 2)) {
+        MergeSortedRanges(first1, last1, first2, last2, output, comp, proj);
+        return;
+    }
+
+    // Items of the first range go before equivalent items of the second, so
+    // the co-rank search is a lower bound in one direction and an upper bound
+    // in the other.
+    InputIt1 split1;
+    InputIt2 split2;
+    if (size1 >= size2) {
+        split1 = first1 + size1 / 2;
+        split2 = std::lower_bound(
+            first2, last2, *split1,
+            [&comp, &proj](const typename std::iterator_traits<
+                               InputIt2>::value_type &item,
+                           const typename std::iterator_traits<
+                               InputIt1>::value_type &value) {
+                return comp(proj(item), proj(value));
+            });
+    }
+    else {
+        split2 = first2 + size2 / 2;
+        split1 = std::upper_bound(
+            first1, last1, *split2,
+            [&comp, &proj](const typename std::iterator_traits<
+                               InputIt2>::value_type &value,
+                           const typename std::iterator_traits<
+                               InputIt1>::value_type &item) {
+                return comp(proj(value), proj(item));
+            });
+    }
+    OutputIt split_output = output + (split1 - first1) + (split2 - first2);
+
+    TaskGroup group(pool);
+    group.Run([=, &pool, &comp, &proj]() {
+        ParallelMergeSortedRanges(
+            first1, split1, first2, split2, output, pool, grain_size,
+            comp, proj);
+    });
+    ParallelMergeSortedRanges(
+        split1, last1, split2, last2, split_output, pool, grain_size,
+        comp, proj);
+    group.Wait();
+}
+
+namespace detail {
+
+/** Parallel version of `PingPongMergeSort`.
+ */
+template <typename RandomIt, typename BufferIt, typename Compare,
+          typename Projection>
+void ParallelPingPongMergeSort(
+        RandomIt first, BufferIt buffer,
+        const typename std::iterator_traits<RandomIt>::difference_type size,
+        const bool into_buffer, ThreadPool &pool, const int grain_size,
+        Compare &comp, Projection &proj) {
+    if (size <= grain_size) {
+        PingPongMergeSort(first, buffer, size, into_buffer, comp, proj);
+        return;
+    }
+
+    auto half = size / 2;
+    TaskGroup group(pool);
+    group.Run([=, &pool, &comp, &proj]() {
+        ParallelPingPongMergeSort(
+            first, buffer, half, !into_buffer, pool, grain_size, comp, proj);
+    });
+    ParallelPingPongMergeSort(
+        first + half, buffer + half, size - half, !into_buffer, pool,
+        grain_size, comp, proj);
+    group.Wait();
+
+    if (into_buffer)
+        ParallelMergeSortedRanges(
+            first, first + half, first + half, first + size, buffer, pool,
+            grain_size, comp, proj);
+    else
+        ParallelMergeSortedRanges(
+            buffer, buffer + half, buffer + half, buffer + size, first, pool,
+            grain_size, comp, proj);
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) by parallel merge sort, with a scratch buffer.
+ *
+ * The two halves of each range are sorted as parallel tasks, and large merges
+ * are themselves split across tasks. Ranges of at most `grain_size` items use
+ * the sequential buffered merge sort. The sort is stable.
+ *
+ * Worst-case performance: Theta(n lg n) work, O(lg^3 n) span
+ *
+ * @param first         Iterator to the first item to be sorted.
+ * @param last          Iterator after the last item to be sorted.
+ * @param buffer        Iterator to scratch space for at least `last - first`
+ *      items; its contents are overwritten.
+ * @param pool          Pool to run the sort on.
+ * @param grain_size    Subranges of at most this many items are sorted
+ *      sequentially.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename BufferIt, typename Compare = Less,
+          typename Projection = Identity>
+void ParallelMergeSortWithBuffer(
+        RandomIt first, RandomIt last, BufferIt buffer, ThreadPool &pool,
+        const int grain_size = kDefaultParallelGrainSize,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    detail::ParallelPingPongMergeSort(
+        first, buffer, last - first, false, pool, std::max(grain_size, 1),
+        comp, proj);
+}
+
+/** Sort the range (in-place) by parallel merge sort.
+ *
+ * Like `ParallelMergeSortWithBuffer`, but allocates the scratch buffer itself.
+ *
+ * @param first         Iterator to the first item to be sorted.
+ * @param last          Iterator after the last item to be sorted.
+ * @param pool          Pool to run the sort on.
+ * @param grain_size    Subranges of at most this many items are sorted
+ *      sequentially.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void ParallelMergeSort(
+        RandomIt first, RandomIt last, ThreadPool &pool,
+        const int grain_size = kDefaultParallelGrainSize,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(
+        last - first);
+    ParallelMergeSortWithBuffer(
+        first, last, buffer.begin(), pool, grain_size, comp, proj);
+}
+
+namespace detail {
+
+/** Number of items in a `[begin, end)` interval of offsets.
+ */
+template <typename Interval>
+typename Interval::first_type IntervalLength(const Interval &interval) {
+    return interval.second - interval.first;
+}
+
+/** Swap the items of one list of index intervals with those of another.
+ *
+ * Both lists describe `[begin, end)` offsets from `first` and hold the same
+ * total number of items; the k-th item of one is swapped with the k-th item of
+ * the other, for k in `[begin_item, end_item)`.
+ */
+template <typename RandomIt, typename Interval>
+void SwapIntervalItems(
+        RandomIt first, const std::vector<Interval> &intervals1,
+        const std::vector<Interval> &intervals2,
+        typename std::iterator_traits<RandomIt>::difference_type begin_item,
+        typename std::iterator_traits<RandomIt>::difference_type end_item) {
+    std::size_t interval1 = 0;
+    std::size_t interval2 = 0;
+    auto offset1 = begin_item;
+    auto offset2 = begin_item;
+    while (offset1 >= IntervalLength(intervals1[interval1]))
+        offset1 -= IntervalLength(intervals1[interval1++]);
+    while (offset2 >= IntervalLength(intervals2[interval2]))
+        offset2 -= IntervalLength(intervals2[interval2++]);
+
+    for (auto item = begin_item; item < end_item; ++item) {
+        SwapItems(first + intervals1[interval1].first + offset1,
+                  first + intervals2[interval2].first + offset2);
+        if (++offset1 == IntervalLength(intervals1[interval1])) {
+            ++interval1;
+            offset1 = 0;
+        }
+        if (++offset2 == IntervalLength(intervals2[interval2])) {
+            ++interval2;
+            offset2 = 0;
+        }
+    }
+}
+
+} // namespace detail
+
+/** Rearrange the range (in-place), partitioning it for quicksort in parallel.
+ *
+ * Same contract as `QuicksortPartition`: the last item is the pivot, and ends
+ * up between the items that go before it and the items that go after it.
+ *
+ * The range is cut into one chunk per thread and each chunk is block
+ * partitioned as a separate task. The left partition then has a known size, so
+ * the right-partition items that landed inside it and the left-partition items
+ * that landed outside it can be listed and swapped pairwise, again split
+ * between the threads. Short ranges are partitioned on the calling thread.
+ *
+ * Worst-case performance: Theta(n) work, O(n / p + p) span
+ *
+ * @param first             Iterator to the first item to be partitioned.
+ * @param last              Iterator after the last item to be partitioned.
+ * @param pool              Pool to run the partition on.
+ * @param grain_size        Each chunk gets at least this many items.
+ * @param comp              Strict weak ordering of the projected items.
+ * @param proj              Projection applied to items before comparing them.
+ * @param equality_check    If true, the left partition will contain items
+ *      equivalent to the pivot. Otherwise, they will be in the right partition.
+ * @return                  Iterator to the pivot after partitioning.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt ParallelQuicksortPartition(
+        RandomIt first, RandomIt last, ThreadPool &pool,
+        const int grain_size = kDefaultParallelGrainSize,
+        Compare comp = Compare(), Projection proj = Projection(),
+        const bool equality_check = true) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type
+        Difference;
+    typedef std::pair<Difference, Difference> Interval;
+
+    RandomIt pivot = last - 1;
+    Difference size = pivot - first;
+    int num_chunks = (int)std::min<Difference>(
+        pool.NumThreads(), size / std::max(grain_size, 1));
+    if (num_chunks <= 1)
+        return QuicksortPartition(
+            first, last, comp, proj, equality_check, PartitionScheme::kBlock);
+
+    // Partition each chunk on its own
+    std::vector<Difference> chunk_begin(num_chunks + 1);
+    for (int chunk = 0; chunk <= num_chunks; ++chunk)
+        chunk_begin[chunk] = size * chunk / num_chunks;
+    std::vector<Difference> chunk_split(num_chunks);
+    {
+        TaskGroup group(pool);
+        for (int chunk = 0; chunk < num_chunks; ++chunk)
+            group.Run([=, &chunk_begin, &chunk_split, &comp, &proj]() {
+                chunk_split[chunk] = detail::BlockSplit(
+                    first + chunk_begin[chunk], first + chunk_begin[chunk + 1],
+                    pivot, comp, proj, equality_check) - first;
+            });
+        group.Wait();
+    }
+
+    // Find the items on the wrong side of the final split
+    Difference num_left = 0;
+    for (int chunk = 0; chunk < num_chunks; ++chunk)
+        num_left += chunk_split[chunk] - chunk_begin[chunk];
+    std::vector<Interval> misplaced_right;
+    std::vector<Interval> misplaced_left;
+    Difference num_misplaced = 0;
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        Difference right_end = std::min(chunk_begin[chunk + 1], num_left);
+        if (chunk_split[chunk] < right_end) {
+            misplaced_right.push_back(
+                Interval(chunk_split[chunk], right_end));
+            num_misplaced += right_end - chunk_split[chunk];
+        }
+        Difference left_begin = std::max(chunk_begin[chunk], num_left);
+        if (left_begin < chunk_split[chunk])
+            misplaced_left.push_back(Interval(left_begin, chunk_split[chunk]));
+    }
+
+    // Swap them pairwise, in parallel
+    if (num_misplaced > 0) {
+        int num_tasks = (int)std::min<Difference>(
+            num_chunks, 1 + num_misplaced / std::max(grain_size, 1));
+        TaskGroup group(pool);
+        for (int task = 0; task < num_tasks; ++task)
+            group.Run([=, &misplaced_right, &misplaced_left]() {
+                detail::SwapIntervalItems(
+                    first, misplaced_right, misplaced_left,
+                    num_misplaced * task / num_tasks,
+                    num_misplaced * (task + 1) / num_tasks);
+            });
+        group.Wait();
+    }
+
+    detail::SwapItems(first + num_left, pivot);
+    return first + num_left;
+}
+
+namespace detail {
+
+/** Parallel quicksort, falling back to introsort after `depth_limit` splits.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void ParallelQuicksortRecursive(
+        RandomIt first, RandomIt last, ThreadPool &pool, const int grain_size,
+        const int depth_limit, Compare &comp, Projection &proj) {
+    auto size = last - first;
+    if (size <= grain_size || depth_limit == 0) {
+        IntroSort(first, last, comp, proj);
+        return;
+    }
+
+    MoveIntroSortPivotToFirst(first, last, comp, proj);
+    SwapItems(first, last - 1);
+    RandomIt pivot = ParallelQuicksortPartition(
+        first, last, pool, grain_size, comp, proj);
+
+    // Items equivalent to the pivot all go left, so a lopsided split usually
+    // means lots of duplicates: split those off so they aren't sorted again
+    RandomIt left_last = pivot;
+    if (last - pivot - 1 < size / 16)
+        left_last = ParallelQuicksortPartition(
+            first, pivot + 1, pool, grain_size, comp, proj, false);
+
+    TaskGroup group(pool);
+    group.Run([=, &pool, &comp, &proj]() {
+        ParallelQuicksortRecursive(
+            first, left_last, pool, grain_size, depth_limit - 1, comp, proj);
+    });
+    ParallelQuicksortRecursive(
+        pivot + 1, last, pool, grain_size, depth_limit - 1, comp, proj);
+    group.Wait();
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) by parallel quicksort.
+ *
+ * Each partition step picks a ninther pivot and uses
+ * `ParallelQuicksortPartition`, so the first few (largest) partitions are
+ * shared between threads; the two sides are then sorted as parallel tasks.
+ * Ranges of at most `grain_size` items are sorted with the sequential
+ * `IntroSort`, which also takes over if the recursion gets deeper than 2 lg n.
+ * The sort is not stable.
+ *
+ * Worst-case performance: Theta(n lg n) work
+ *
+ * @param first         Iterator to the first item to be sorted.
+ * @param last          Iterator after the last item to be sorted.
+ * @param pool          Pool to run the sort on.
+ * @param grain_size    Subranges of at most this many items are sorted
+ *      sequentially.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void ParallelQuicksort(
+        RandomIt first, RandomIt last, ThreadPool &pool,
+        const int grain_size = kDefaultParallelGrainSize,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    int depth_limit = 0;
+    for (auto size = last - first; size > 1; size /= 2)
+        depth_limit += 2;
+    detail::ParallelQuicksortRecursive(
+        first, last, pool, std::max(grain_size, kIntroSortInsertionCutoff),
+        depth_limit, comp, proj);
+}
+
+/** Write a sorted copy of the range using parallel counting sort.
+ *
+ * The range is cut into one chunk per thread. Each chunk's keys are counted
+ * into a histogram of its own; a parallel exclusive scan over the histograms,
+ * in (key, chunk) order, then gives every chunk the output position of its
+ * first item with each key, so the chunks can be scattered independently. As
+ * chunks with lower indices get lower positions for the same key, the sort is
+ * stable.
+ *
+ * Worst-case performance: Theta(n + p (max - min)) work,
+ *      O(n / p + max - min) span
+ *
+ * @param first         Iterator to the first item to be sorted.
+ * @param last          Iterator after the last item to be sorted.
+ * @param output        Iterator to the start of the output range.
+ * @param min           Smallest key in the input range.
+ * @param max           Largest key in the input range.
+ * @param pool          Pool to run the sort on.
+ * @param grain_size    Each chunk gets at least this many items.
+ * @param proj          Projection giving the integer key of an item.
+ */
+template <typename RandomIt, typename RandomOutputIt,
+          typename Projection = Identity>
+void ParallelCountingSort(
+        RandomIt first, RandomIt last, RandomOutputIt output,
+        const long long min, const long long max, ThreadPool &pool,
+        const int grain_size = kDefaultParallelGrainSize,
+        Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::value_type Item;
+    typedef typename std::iterator_traits<RandomIt>::difference_type
+        Difference;
+
+    Difference size = last - first;
+    int num_chunks = (int)std::max<Difference>(1, std::min<Difference>(
+        pool.NumThreads(), size / std::max(grain_size, 1)));
+    if (num_chunks == 1) {
+        CountingSort(first, last, output, min, max, proj);
+        return;
+    }
+    std::size_t num_keys = (std::size_t)(max - min + 1);
+    auto key = [&proj, min](const Item &item) {
+        return (std::size_t)(proj(item) - min);
+    };
+
+    // Row `chunk` of the table counts the keys of that chunk
+    std::vector<std::size_t> key_counts(num_chunks * num_keys, 0);
+    {
+        TaskGroup group(pool);
+        for (int chunk = 0; chunk < num_chunks; ++chunk)
+            group.Run([=, &key_counts]() {
+                std::size_t *counts = &key_counts[chunk * num_keys];
+                for (RandomIt item = first + size * chunk / num_chunks;
+                     item != first + size * (chunk + 1) / num_chunks; ++item)
+                    ++counts[key(*item)];
+            });
+        group.Wait();
+    }
+
+    // Exclusive scan in (key, chunk) order: each task totals a block of keys,
+    // the block totals are scanned serially, and then each task turns its
+    // block's counts into offsets
+    std::vector<std::size_t> block_offsets(num_chunks + 1, 0);
+    auto key_block_begin = [num_keys, num_chunks](const int block) {
+        return num_keys * block / num_chunks;
+    };
+    {
+        TaskGroup group(pool);
+        for (int block = 0; block < num_chunks; ++block)
+            group.Run([=, &key_counts, &block_offsets]() {
+                std::size_t total = 0;
+                for (std::size_t k = key_block_begin(block);
+                     k < key_block_begin(block + 1); ++k)
+                    for (int chunk = 0; chunk < num_chunks; ++chunk)
+                        total += key_counts[chunk * num_keys + k];
+                block_offsets[block + 1] = total;
+            });
+        group.Wait();
+    }
+    for (int block = 0; block < num_chunks; ++block)
+        block_offsets[block + 1] += block_offsets[block];
+    {
+        TaskGroup group(pool);
+        for (int block = 0; block < num_chunks; ++block)
+            group.Run([=, &key_counts, &block_offsets]() {
+                std::size_t offset = block_offsets[block];
+                for (std::size_t k = key_block_begin(block);
+                     k < key_block_begin(block + 1); ++k)
+                    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+                        std::size_t &count = key_counts[chunk * num_keys + k];
+                        std::size_t chunk_count = count;
+                        count = offset;
+                        offset += chunk_count;
+                    }
+            });
+        group.Wait();
+    }
+
+    TaskGroup group(pool);
+    for (int chunk = 0; chunk < num_chunks; ++chunk)
+        group.Run([=, &key_counts]() {
+            detail::StableScatterByKey(
+                first + size * chunk / num_chunks,
+                first + size * (chunk + 1) / num_chunks, output,
+                &key_counts[chunk * num_keys], key);
+        });
+    group.Wait();
+}
+
+/** Sort the vector (in-place) in ascending order, using parallel merge sort.
+ *
+ * @param vec           Vector to be sorted.
+ * @param num_threads   Number of threads to sort with; 0 means one per core.
+ * @param grain_size    Subvectors of at most this many items are sorted
+ *      sequentially.
+ */
+void ParallelMergeSort(
+        std::vector<int> &vec, const int num_threads = 0,
+        const int grain_size = kDefaultParallelGrainSize);
+
+/** Sort the vector (in-place) in ascending order, using parallel quicksort.
+ *
+ * @param vec           Vector to be sorted.
+ * @param num_threads   Number of threads to sort with; 0 means one per core.
+ * @param grain_size    Subvectors of at most this many items are sorted
+ *      sequentially.
+ */
+void ParallelQuicksort(
+        std::vector<int> &vec, const int num_threads = 0,
+        const int grain_size = kDefaultParallelGrainSize);
+
+/** Return sorted version of input vector using parallel counting sort.
+ *
+ * @param input_vec     Vector to be sorted
+ * @param min           Smallest value in the input vector
+ * @param max           Largest value in the input vector
+ * @param num_threads   Number of threads to sort with; 0 means one per core.
+ * @param grain_size    Each thread's chunk gets at least this many items.
+ *
+ * @return              Sorted input vector
+ */
+std::vector<int> ParallelCountingSort(
+        std::vector<int> &input_vec, const int min, const int max,
+        const int num_threads = 0,
+        const int grain_size = kDefaultParallelGrainSize);
+
+#endif //ALGORITHMS_STUDY_CPP_PARALLEL_SORT_HPP
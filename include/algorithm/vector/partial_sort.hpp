@@ -0,0 +1,274 @@
+/** Partial sorting: the k smallest (or largest) items, and the n-th item.
+ *
+ * For when only the top of the order is wanted: these do O(n) or
+ * O(n log k) work instead of a full O(n log n) sort.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_PARTIAL_SORT_HPP
+#define ALGORITHMS_STUDY_CPP_PARTIAL_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "algorithm/vector/generic_heap.hpp"
+#include "algorithm/vector/generic_sort.hpp"
+
+
+/** Ranges at most this long are insertion sorted by the selection loop.
+ */
+const int kSelectInsertionCutoff = 16;
+
+/** Partitioning work, in multiples of the range size, that the selection
+ * loop may spend on random pivots before it switches to median of medians.
+ *
+ * Random pivots take about 3.4 n item visits on average to find a median, so
+ * the budget is seldom used up, but when it is the rest is still linear.
+ */
+const int kIntroselectWorkFactor = 8;
+
+namespace detail {
+
+template <typename RandomIt, typename Compare, typename Projection>
+void SelectLoop(
+        RandomIt first, RandomIt nth, RandomIt last,
+        typename std::iterator_traits<RandomIt>::difference_type work_budget,
+        Compare &comp, Projection &proj);
+
+/** Return a pivot found by the median of medians ("BFPRT") method.
+ *
+ * The medians of groups of five items are moved to the front of the range,
+ * and their median is selected (recursively, with median of medians only).
+ * At least 3/10 of the items are not less than it, and 3/10 not greater.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+RandomIt MedianOfMediansPivot(
+        RandomIt first, RandomIt last, Compare &comp, Projection &proj) {
+    auto size = last - first;
+    decltype(size) num_groups = 0;
+    for (RandomIt group = first; group < last; group += 5) {
+        RandomIt group_end = group + std::min<decltype(size)>(5, last - group);
+        InsertionSort(group, group_end, comp, proj);
+        SwapItems(first + num_groups++, group + (group_end - group - 1) / 2);
+    }
+    RandomIt median = first + (num_groups - 1) / 2;
+    SelectLoop(first, median, first + num_groups, 0, comp, proj);
+    return median;
+}
+
+/** Rearrange the range so the item at `nth` is the one that would be there
+ * if it were sorted (introselect).
+ *
+ * Quickselect with random pivots (`RandomizedQuicksortPartition`) until
+ * `work_budget` item visits are spent, then median of medians pivots. Items
+ * equivalent to the pivot are gathered next to it before looking left of
+ * it, so many duplicates don't slow it down.
+ */
+template <typename RandomIt, typename Compare, typename Projection>
+void SelectLoop(
+        RandomIt first, RandomIt nth, RandomIt last,
+        typename std::iterator_traits<RandomIt>::difference_type work_budget,
+        Compare &comp, Projection &proj) {
+    const int leaf_size = LeafSize(first, comp, proj, kSelectInsertionCutoff);
+    while (last - first > leaf_size) {
+        auto size = last - first;
+        RandomIt split;
+        if (work_budget >= size) {
+            work_budget -= size;
+            split = RandomizedQuicksortPartition(
+                first, last, comp, proj, PartitionScheme::kVectorized);
+        }
+        else {
+            SwapItems(MedianOfMediansPivot(first, last, comp, proj), last - 1);
+            split = QuicksortPartition(
+                first, last, comp, proj, true, PartitionScheme::kVectorized);
+        }
+
+        if (nth == split)
+            return;
+        if (nth > split) {
+            first = split + 1;
+        }
+        else {
+            // The left side holds the items equivalent to the pivot too
+            RandomIt equal_begin = QuicksortPartition(
+                first, split + 1, comp, proj, false,
+                PartitionScheme::kVectorized);
+            if (nth >= equal_begin)
+                return;
+            last = equal_begin;
+        }
+    }
+    SortSmallRange(first, last, comp, proj);
+}
+
+} // namespace detail
+
+/** Rearrange the range so the item at `nth` is the one that would be there
+ * if the range were sorted.
+ *
+ * No item before `nth` goes after it, and no item after it goes before it.
+ * Uses introselect: quickselect with random pivots, falling back to median
+ * of medians pivots if they are unlucky for too long, so the worst case is
+ * still linear.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param nth   Iterator to the position to be filled with its sorted item.
+ * @param last  Iterator after the last item of the range.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void NthElement(
+        RandomIt first, RandomIt nth, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    if (nth == last)
+        return;
+    detail::SelectLoop(
+        first, nth, last, kIntroselectWorkFactor * (last - first), comp, proj);
+}
+
+/** Ranges with more than this many items per wanted item are partially
+ * sorted with a heap; others by selection and then sorting.
+ */
+const int kPartialSortHeapRatio = 16;
+
+/** Sort the smallest `middle - first` items of the range into
+ * `[first, middle)`, leaving the rest of the items in `[middle, last)` in
+ * unspecified order.
+ *
+ * For small k, a max-heap of the k smallest items seen so far is kept in
+ * `[first, middle)` while the rest of the range is scanned, and then
+ * heapsorted: O(n log k). For larger k, `NthElement` splits off the k
+ * smallest, which are then introsorted: O(n + k log k).
+ *
+ * Worst-case performance: O(n + k log k) or O(n log k), for k = middle - first
+ *
+ * @param first     Iterator to the first item of the range.
+ * @param middle    Iterator after the last position to be sorted.
+ * @param last      Iterator after the last item of the range.
+ * @param comp      Strict weak ordering of the projected items.
+ * @param proj      Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void PartialSort(
+        RandomIt first, RandomIt middle, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto k = middle - first;
+    if (k == 0)
+        return;
+    if (k > (last - first) / kPartialSortHeapRatio) {
+        NthElement(first, middle - 1, last, comp, proj);
+        IntroSort(first, middle - 1, comp, proj);
+        return;
+    }
+
+    MaxHeapBuilder(first, middle, comp, proj);
+    for (RandomIt item = middle; item != last; ++item)
+        if (detail::ProjectedLess(comp, proj, *item, *first)) {
+            detail::SwapItems(item, first);
+            MaxHeapify(first, 0, k, comp, proj);
+        }
+    for (RandomIt heap_end = middle; heap_end - first > 1; --heap_end)
+        MaxHeapExtractMax(first, heap_end, comp, proj);
+}
+
+/** Keeps the k largest items of a stream, in a min-heap of k items.
+ *
+ * Each item is compared to the smallest item kept (the root of the heap),
+ * and only replaces it if it is larger, so a stream of n items costs
+ * O(n log k) time and O(k) memory however long it is. Of equivalent items,
+ * the first ones pushed are kept.
+ */
+template <typename T, typename Compare = Less, typename Projection = Identity>
+class TopKHeap {
+public:
+    /** Create an empty heap that keeps at most `k` items.
+     *
+     * @param k     Number of items to keep.
+     * @param comp  Strict weak ordering of the projected items.
+     * @param proj  Projection applied to items before comparing them.
+     */
+    explicit TopKHeap(
+            const std::size_t k,
+            Compare comp = Compare(), Projection proj = Projection())
+        : k_(k), comp_(comp), proj_(proj) {
+        heap_.reserve(k);
+    }
+
+    /** Offer an item; it is kept if it is among the k largest so far. */
+    void Push(const T &item) {
+        if (heap_.size() < k_) {
+            heap_.push_back(item);
+            MinHeapInsert(heap_.begin(), heap_.end(), comp_, proj_);
+        }
+        else if (k_ > 0 &&
+                 detail::ProjectedLess(comp_, proj_, heap_[0], item)) {
+            heap_[0] = item;
+            MinHeapify(heap_.begin(), 0, heap_.size(), comp_, proj_);
+        }
+    }
+
+    /** Offer every item of a range. */
+    template <typename InputIt>
+    void Push(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            Push(*first);
+    }
+
+    /** Number of items kept (k, once at least k were pushed). */
+    std::size_t size() const { return heap_.size(); }
+
+    /** The k-th largest item so far (the smallest kept; must not be empty). */
+    const T &Min() const { return heap_[0]; }
+
+    /** The items kept, largest first. */
+    std::vector<T> Sorted() const {
+        std::vector<T> items(heap_);
+        // Extracting the minimum to the end of the heap each time leaves the
+        // items in descending order
+        for (auto heap_end = items.end(); heap_end - items.begin() > 1;
+             --heap_end)
+            MinHeapExtractMin(items.begin(), heap_end, comp_, proj_);
+        return items;
+    }
+
+private:
+    std::size_t k_;
+    std::vector<T> heap_;
+    mutable Compare comp_;
+    mutable Projection proj_;
+};
+
+/** Return the `k` largest items of the range, largest first.
+ *
+ * Streams the range through a `TopKHeap`, so it can be read just once, from
+ * any input iterators.
+ *
+ * Worst-case performance: O(n log k)
+ *
+ * @param first Iterator to the first item.
+ * @param last  Iterator after the last item.
+ * @param k     Number of items wanted.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      The (at most) `k` largest items, in descending order.
+ */
+template <typename InputIt, typename Compare = Less,
+          typename Projection = Identity>
+std::vector<typename std::iterator_traits<InputIt>::value_type> TopK(
+        InputIt first, InputIt last, const std::size_t k,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    TopKHeap<typename std::iterator_traits<InputIt>::value_type, Compare,
+             Projection> top(k, comp, proj);
+    top.Push(first, last);
+    return top.Sorted();
+}
+
+#endif //ALGORITHMS_STUDY_CPP_PARTIAL_SORT_HPP
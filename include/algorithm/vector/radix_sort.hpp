@@ -0,0 +1,390 @@
+/** Radix sorts for integer and floating-point keys.
+ *
+ * Unlike `CountingSort`, these don't need the key range up front: keys are
+ * mapped to unsigned integers of the same width whose order matches the key
+ * order (see `RadixKeyTraits`), and those are sorted a digit at a time. So
+ * the `CountingSort` that finds the key range itself falls back on them when
+ * that range turns out too wide.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_RADIX_SORT_HPP
+#define ALGORITHMS_STUDY_CPP_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "algorithm/counters.hpp"
+#include "algorithm/vector/generic_sort.hpp"
+#include "algorithm/vector/min_max.hpp"
+
+
+/** Maps keys to unsigned integers ("bits") that sort in the same order.
+ *
+ * Specialized for the integer types, `float` and `double`.
+ */
+template <typename Key, typename Enable = void>
+struct RadixKeyTraits;
+
+/** Integers: flipping the sign bit puts negative keys before positive ones.
+ */
+template <typename Key>
+struct RadixKeyTraits<
+        Key, typename std::enable_if<std::is_integral<Key>::value>::type> {
+    typedef typename std::make_unsigned<Key>::type Bits;
+
+    static Bits ToBits(const Key key) {
+        const Bits sign_bit = (Bits)((Bits)1 << (8 * sizeof(Bits) - 1));
+        return std::is_signed<Key>::value ?
+            (Bits)((Bits)key ^ sign_bit) : (Bits)key;
+    }
+};
+
+namespace detail {
+
+/** Order-preserving bits of an IEEE 754 float.
+ *
+ * Positive floats already order like their bit patterns, so only the sign bit
+ * needs setting; negative ones order in reverse, so all their bits are
+ * flipped. NaNs end up before (negative sign) or after (positive sign) every
+ * other value.
+ */
+template <typename Bits, typename Float>
+Bits FloatRadixBits(const Float key) {
+    static_assert(sizeof(Bits) == sizeof(Float), "Bits must match the float");
+    const Bits sign_bit = (Bits)1 << (8 * sizeof(Bits) - 1);
+    Bits bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    return (bits & sign_bit) ? (Bits)~bits : (Bits)(bits | sign_bit);
+}
+
+} // namespace detail
+
+template <>
+struct RadixKeyTraits<float> {
+    typedef std::uint32_t Bits;
+
+    static Bits ToBits(const float key) {
+        return detail::FloatRadixBits<Bits>(key);
+    }
+};
+
+template <>
+struct RadixKeyTraits<double> {
+    typedef std::uint64_t Bits;
+
+    static Bits ToBits(const double key) {
+        return detail::FloatRadixBits<Bits>(key);
+    }
+};
+
+/** Bits per radix sort digit for keys of up to 16 bits (one byte per pass).
+ */
+const int kRadixSortSmallDigitBits = 8;
+
+/** Bits per radix sort digit for wider keys.
+ *
+ * 2^11 counters still fit in L1 cache, and cut the passes over 32-bit keys
+ * from four to three (64-bit keys from eight to six).
+ */
+const int kRadixSortDigitBits = 11;
+
+namespace detail {
+
+/** Key function giving the digit at `shift` of an item's radix bits.
+ *
+ * Like `OffsetKey`, it projects whatever the iterators yield as it is.
+ */
+template <typename Projection, typename Bits>
+struct RadixDigit {
+    Projection &proj;
+    int shift;
+    Bits mask;
+
+    template <typename Item>
+    std::size_t operator()(const Item &item) const {
+        typedef typename std::decay<decltype(proj(item))>::type Key;
+        return (std::size_t)(
+            (RadixKeyTraits<Key>::ToBits(proj(item)) >> shift) & mask);
+    }
+};
+
+} // namespace detail
+
+/** Sort the range (in-place) by least-significant-digit radix sort, using a
+ * scratch buffer.
+ *
+ * Each pass is a stable counting sort by one digit of the keys, moving the
+ * items between the range and the buffer. One read of the input builds the
+ * histograms of all the passes, and a pass is skipped when all the keys have
+ * the same digit (e.g. the high digits of small values). The sort is stable.
+ *
+ * Worst-case performance: Theta(n w / d), for w-bit keys and d-bit digits
+ *
+ * @param first     Iterator to the first item to be sorted.
+ * @param last      Iterator after the last item to be sorted.
+ * @param buffer    Iterator to scratch space for at least `last - first`
+ *      items; its contents are overwritten.
+ * @param proj      Projection giving the integer or floating-point key of an
+ *      item.
+ */
+template <typename RandomIt, typename BufferIt, typename Projection = Identity>
+void LsdRadixSortWithBuffer(
+        RandomIt first, RandomIt last, BufferIt buffer,
+        Projection proj = Projection()) {
+    typedef typename std::decay<decltype(proj(*first))>::type Key;
+    typedef RadixKeyTraits<Key> Traits;
+    typedef typename Traits::Bits Bits;
+
+    const int key_bits = 8 * (int)sizeof(Bits);
+    const int digit_bits = key_bits <= 16 ?
+        kRadixSortSmallDigitBits : kRadixSortDigitBits;
+    const int num_passes = (key_bits + digit_bits - 1) / digit_bits;
+    const std::size_t num_buckets = (std::size_t)1 << digit_bits;
+    const Bits digit_mask = (Bits)(num_buckets - 1);
+
+    const std::size_t size = last - first;
+    if (size < 2)
+        return;
+
+    // One read of the input fills in the histograms for every pass
+    std::vector<std::size_t> counts(num_passes * num_buckets, 0);
+    for (RandomIt item = first; item != last; ++item) {
+        Bits bits = Traits::ToBits(proj(*item));
+        for (int pass = 0; pass < num_passes; ++pass)
+            ++counts[pass * num_buckets +
+                     ((bits >> (pass * digit_bits)) & digit_mask)];
+    }
+
+    bool in_buffer = false;
+    for (int pass = 0; pass < num_passes; ++pass) {
+        std::size_t *pass_counts = &counts[pass * num_buckets];
+        // If every key has the same digit, this pass would only copy
+        if (std::find(pass_counts, pass_counts + num_buckets, size) !=
+                pass_counts + num_buckets)
+            continue;
+
+        detail::RadixDigit<Projection, Bits> digit = {
+            proj, pass * digit_bits, digit_mask};
+        detail::CountsToOffsets(pass_counts, num_buckets);
+        if (in_buffer)
+            detail::StableScatterByKey(
+                std::make_move_iterator(buffer),
+                std::make_move_iterator(buffer + size), first, pass_counts,
+                digit);
+        else
+            detail::StableScatterByKey(
+                std::make_move_iterator(first), std::make_move_iterator(last),
+                buffer, pass_counts, digit);
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) {
+        std::move(buffer, buffer + size, first);
+        COUNT_MOVES(size);
+    }
+}
+
+/** Sort the range (in-place) by least-significant-digit radix sort.
+ *
+ * Like `LsdRadixSortWithBuffer`, but allocates the scratch buffer itself.
+ *
+ * @param first     Iterator to the first item to be sorted.
+ * @param last      Iterator after the last item to be sorted.
+ * @param proj      Projection giving the integer or floating-point key of an
+ *      item.
+ */
+template <typename RandomIt, typename Projection = Identity>
+void LsdRadixSort(
+        RandomIt first, RandomIt last, Projection proj = Projection()) {
+    std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(
+        last - first);
+    LsdRadixSortWithBuffer(first, last, buffer.begin(), proj);
+}
+
+/** Key ranges up to this many times the number of items are counting
+ * sorted by the `CountingSort` overloads that find the range themselves;
+ * wider ones are radix sorted instead.
+ *
+ * Past a few counters per item, the histogram costs more to clear and scan
+ * than the radix sort's passes over the items.
+ */
+const int kCountingSortMaxRangePerItem = 4;
+
+/** Key ranges up to this long are counting sorted whatever the number of
+ * items (the histogram is no larger than the radix sort's).
+ */
+const int kCountingSortMinRange = 1 << 13;
+
+namespace detail {
+
+/** Return whether counting sort suits `size` items with keys in
+ * `[min, max]`, rather than radix sort.
+ */
+inline bool IsCountingSortRange(
+        const long long min, const long long max, const std::size_t size) {
+    // The difference wraps correctly even where it overflows a long long
+    unsigned long long range =
+        (unsigned long long)max - (unsigned long long)min;
+    return range < (unsigned long long)kCountingSortMinRange ||
+           range / kCountingSortMaxRangePerItem < size;
+}
+
+} // namespace detail
+
+/** Write a sorted copy of the range using the counting sort algorithm.
+ *
+ * Like the overload of `generic_sort.hpp`, but finds the range of the keys
+ * itself, with `MinMaxElement` (one more pass over the input, with about
+ * 1.5 n comparisons). The caller can't know beforehand how large a histogram
+ * that range would take (up to 2^32 counters for ints), so when the range is
+ * more than `kCountingSortMaxRangePerItem` times the number of items, the
+ * items are copied to the output and radix sorted there (`LsdRadixSort`)
+ * instead. The sort is stable either way.
+ *
+ * Worst-case performance: Theta(n + max - min) for a narrow key range;
+ * otherwise that of `LsdRadixSort`
+ *
+ * @param first     Iterator to the first item to be sorted.
+ * @param last      Iterator after the last item to be sorted.
+ * @param output    Iterator to the start of the output range.
+ * @param proj      Projection giving the integer key of an item.
+ */
+template <typename ForwardIt, typename RandomOutputIt,
+          typename Projection = Identity>
+void CountingSort(
+        ForwardIt first, ForwardIt last, RandomOutputIt output,
+        Projection proj = Projection()) {
+    if (first == last)
+        return;
+    auto extremes = MinMaxElement(first, last, Less(), proj);
+    long long min = (long long)proj(*extremes.first);
+    long long max = (long long)proj(*extremes.second);
+    if (detail::IsCountingSortRange(min, max, std::distance(first, last))) {
+        CountingSort(first, last, output, min, max, proj);
+        return;
+    }
+    RandomOutputIt output_last = std::copy(first, last, output);
+    COUNT_MOVES(output_last - output);
+    LsdRadixSort(output, output_last, proj);
+}
+
+/** Buckets at most this long are insertion-sorted by `AmericanFlagSort`.
+ */
+const int kAmericanFlagSortInsertionCutoff = 32;
+
+namespace detail {
+
+/** Projection giving the order-preserving radix bits of an item's key.
+ */
+template <typename Projection>
+struct RadixBitsProjection {
+    Projection proj;
+
+    template <typename Item>
+    auto operator()(const Item &item) const -> typename RadixKeyTraits<
+            typename std::decay<decltype(proj(item))>::type>::Bits {
+        typedef typename std::decay<decltype(proj(item))>::type Key;
+        return RadixKeyTraits<Key>::ToBits(proj(item));
+    }
+};
+
+// Ordering ints by their radix bits is ordering them by value, so short
+// buckets of ints can go to the sorting networks too
+template <>
+struct SmallSorter<int *, Less, RadixBitsProjection<Identity>>
+    : SortingNetworkSmallSorter<int *> {};
+
+template <>
+struct SmallSorter<
+        std::vector<int>::iterator, Less, RadixBitsProjection<Identity>>
+    : SortingNetworkSmallSorter<std::vector<int>::iterator> {};
+
+/** American flag sort of one bucket, by the byte at `shift` and below.
+ */
+template <typename RandomIt, typename Projection>
+void AmericanFlagSortRecursive(
+        RandomIt first, RandomIt last, const int shift,
+        RadixBitsProjection<Projection> &bits) {
+    const int num_buckets = 256;
+    auto size = last - first;
+    Less less;
+    if (size <= LeafSize(first, less, bits, kAmericanFlagSortInsertionCutoff)) {
+        SortSmallRange(first, last, less, bits);
+        return;
+    }
+
+    auto digit = [&bits, shift](
+            const typename std::iterator_traits<RandomIt>::value_type &item) {
+        return (int)((bits(item) >> shift) & 0xff);
+    };
+    std::size_t bucket_next[num_buckets] = {};
+    std::size_t bucket_end[num_buckets];
+    for (RandomIt item = first; item != last; ++item)
+        ++bucket_next[digit(*item)];
+    std::size_t offset = 0;
+    for (int bucket = 0; bucket < num_buckets; ++bucket) {
+        offset += bucket_next[bucket];
+        bucket_end[bucket] = offset;
+        bucket_next[bucket] = offset - bucket_next[bucket];
+    }
+
+    // Walk each bucket's unfilled slots, swapping every item found there
+    // straight into the next free slot of its own bucket
+    for (int bucket = 0; bucket < num_buckets; ++bucket) {
+        while (bucket_next[bucket] < bucket_end[bucket]) {
+            RandomIt item = first + bucket_next[bucket];
+            int item_bucket = digit(*item);
+            if (item_bucket == bucket)
+                ++bucket_next[bucket];
+            else
+                SwapItems(item, first + bucket_next[item_bucket]++);
+        }
+    }
+
+    if (shift == 0)
+        return;
+    std::size_t bucket_begin = 0;
+    for (int bucket = 0; bucket < num_buckets; ++bucket) {
+        if (bucket_end[bucket] - bucket_begin > 1)
+            AmericanFlagSortRecursive(
+                first + bucket_begin, first + bucket_end[bucket], shift - 8,
+                bits);
+        bucket_begin = bucket_end[bucket];
+    }
+}
+
+} // namespace detail
+
+/** Sort the range (in-place) by most-significant-digit radix sort.
+ *
+ * Uses the "American flag sort" algorithm: the items are counted by their top
+ * byte, permuted in place into one bucket per byte value by following swap
+ * cycles, and then each bucket is sorted recursively by the next byte. Short
+ * buckets are finished off with insertion sort (or sorting networks, for
+ * ints). Besides the recursion (one level per key byte), only a few
+ * fixed-size tables of counters are needed, so the extra memory doesn't grow
+ * with the input. The sort is not stable.
+ *
+ * Worst-case performance: Theta(n w / 8), for w-bit keys
+ *
+ * @param first     Iterator to the first item to be sorted.
+ * @param last      Iterator after the last item to be sorted.
+ * @param proj      Projection giving the integer or floating-point key of an
+ *      item.
+ */
+template <typename RandomIt, typename Projection = Identity>
+void AmericanFlagSort(
+        RandomIt first, RandomIt last, Projection proj = Projection()) {
+    typedef typename std::decay<decltype(proj(*first))>::type Key;
+    detail::RadixBitsProjection<Projection> bits = {proj};
+    detail::AmericanFlagSortRecursive(
+        first, last,
+        8 * (int)sizeof(typename RadixKeyTraits<Key>::Bits) - 8, bits);
+}
+
+#endif //ALGORITHMS_STUDY_CPP_RADIX_SORT_HPP
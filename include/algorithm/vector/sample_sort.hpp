@@ -0,0 +1,260 @@
+/** Multithreaded sample sort.
+ *
+ * Sample sort splits the input into buckets by comparing each item against a
+ * few splitters drawn from a random sample, so that every item of a bucket
+ * goes before every item of the next one; the buckets can then be sorted
+ * independently. The input is treated as a set of shards (one per thread),
+ * and the only step that moves items between shards is the bucket exchange,
+ * which is kept behind its own interface (see `SharedMemoryBucketExchange`) so
+ * that it can be replaced by one that talks to other processes.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_SAMPLE_SORT_HPP
+#define ALGORITHMS_STUDY_CPP_SAMPLE_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/random.hpp"
+#include "algorithm/vector/generic_sort.hpp"
+#include "algorithm/vector/parallel_sort.hpp"
+
+
+/** Sample items drawn per bucket when choosing the splitters.
+ */
+const int kSampleSortOversampling = 16;
+
+/** Most buckets a sample sort splits its input into.
+ */
+const int kSampleSortMaxBuckets = 256;
+
+/** A search tree over sorted splitters, for classifying keys into buckets.
+ *
+ * The splitters are kept in breadth-first ("Eytzinger") order, so finding a
+ * key's bucket is a fixed number of steps down the tree, each of which picks
+ * a child with the comparison result instead of a branch. The number of
+ * buckets is rounded up to a power of two by repeating the last splitter.
+ *
+ * A key goes in bucket `b` if it is greater than splitter `b - 1` and not
+ * greater than splitter `b`.
+ */
+template <typename Key, typename Compare = Less>
+class SplitterTree {
+public:
+    /** Build the tree.
+     *
+     * @param sorted_splitters  Splitters, in ascending order (at least one).
+     * @param comp              Strict weak ordering of the keys.
+     */
+    explicit SplitterTree(
+            const std::vector<Key> &sorted_splitters,
+            Compare comp = Compare())
+        : levels_(0), comp_(comp) {
+        while (((std::size_t)1 << levels_) <= sorted_splitters.size())
+            ++levels_;
+        num_buckets_ = (std::size_t)1 << levels_;
+        tree_.resize(num_buckets_, sorted_splitters.back());
+        std::size_t next_splitter = 0;
+        Fill(1, sorted_splitters, next_splitter);
+    }
+
+    /** Number of buckets keys are classified into. */
+    int NumBuckets() const { return (int)num_buckets_; }
+
+    /** Return the bucket of a key. */
+    int Classify(const Key &key) const {
+        std::size_t node = 1;
+        for (int level = 0; level < levels_; ++level)
+            node = 2 * node + comp_(tree_[node], key);
+        return (int)(node - num_buckets_);
+    }
+
+private:
+    /** Place splitters into the subtree at `node` by in-order traversal. */
+    void Fill(
+            const std::size_t node, const std::vector<Key> &sorted_splitters,
+            std::size_t &next_splitter) {
+        if (node >= num_buckets_)
+            return;
+        Fill(2 * node, sorted_splitters, next_splitter);
+        if (next_splitter < sorted_splitters.size())
+            tree_[node] = sorted_splitters[next_splitter++];
+        Fill(2 * node + 1, sorted_splitters, next_splitter);
+    }
+
+    // Node 1 is the root, and node i has children 2i and 2i + 1; index 0 is
+    // unused
+    std::vector<Key> tree_;
+    int levels_;
+    std::size_t num_buckets_;
+    Compare comp_;
+};
+
+/** Bucket exchange between shards that share one address space.
+ *
+ * A bucket exchange takes input split into shards and a function giving each
+ * item's bucket, and delivers the items to `output` grouped by bucket, in
+ * bucket order, returning where each bucket starts. Items keep their relative
+ * order within a bucket. This is the step where every shard sends items to
+ * every other, so a multi-process sort would replace this class with one that
+ * does an all-to-all exchange between processes, leaving the rest unchanged.
+ *
+ * This stand-in counts each shard's items per bucket on its own thread,
+ * computes where each (bucket, shard) pair goes, and then lets every shard
+ * write its items straight to their destinations.
+ */
+class SharedMemoryBucketExchange {
+public:
+    /** @param pool  Pool whose threads stand in for the shards' owners. */
+    explicit SharedMemoryBucketExchange(ThreadPool &pool) : pool_(pool) {}
+
+    /** Number of shards the input is split into. */
+    int NumShards() const { return pool_.NumThreads(); }
+
+    /** Group the items by bucket.
+     *
+     * @param first         Iterator to the first item.
+     * @param last          Iterator after the last item.
+     * @param output        Iterator to the start of the output range.
+     * @param num_buckets   Number of buckets.
+     * @param bucket        Function giving the bucket of an item.
+     * @return              Output offset of each bucket's first item, plus
+     *      the total number of items at the end.
+     */
+    template <typename RandomIt, typename RandomOutputIt,
+              typename BucketFunction>
+    std::vector<std::size_t> Exchange(
+            RandomIt first, RandomIt last, RandomOutputIt output,
+            const int num_buckets, BucketFunction bucket) {
+        std::size_t size = last - first;
+        int num_shards = NumShards();
+        auto shard_begin = [=](const int shard) {
+            return first + size * shard / num_shards;
+        };
+
+        // Row `shard` of the table counts the items of each bucket in that
+        // shard
+        std::vector<std::size_t> counts(num_shards * num_buckets, 0);
+        {
+            TaskGroup group(pool_);
+            for (int shard = 0; shard < num_shards; ++shard)
+                group.Run([=, &counts]() {
+                    std::size_t *shard_counts = &counts[shard * num_buckets];
+                    for (RandomIt item = shard_begin(shard);
+                         item != shard_begin(shard + 1); ++item)
+                        ++shard_counts[bucket(*item)];
+                });
+            group.Wait();
+        }
+
+        // Bucket by bucket, each shard's items go after the previous shard's
+        std::vector<std::size_t> bucket_begin(num_buckets + 1);
+        std::size_t offset = 0;
+        for (int b = 0; b < num_buckets; ++b) {
+            bucket_begin[b] = offset;
+            for (int shard = 0; shard < num_shards; ++shard) {
+                std::size_t count = counts[shard * num_buckets + b];
+                counts[shard * num_buckets + b] = offset;
+                offset += count;
+            }
+        }
+        bucket_begin[num_buckets] = offset;
+
+        TaskGroup group(pool_);
+        for (int shard = 0; shard < num_shards; ++shard)
+            group.Run([=, &counts]() {
+                detail::StableScatterByKey(
+                    shard_begin(shard), shard_begin(shard + 1), output,
+                    &counts[shard * num_buckets], bucket);
+            });
+        group.Wait();
+        return bucket_begin;
+    }
+
+private:
+    ThreadPool &pool_;
+};
+
+/** Sort the range (in-place) by parallel sample sort.
+ *
+ * 1. Sample `kSampleSortOversampling` items per bucket with `RandomlySample`,
+ *    sort the sample and take evenly spaced items of it as splitters.
+ * 2. Hand the input to the bucket exchange, which classifies every item with
+ *    a `SplitterTree` and groups the items by bucket in a scratch buffer.
+ * 3. Sort each bucket as a separate task (with `IntroSort`, i.e. quicksort
+ *    falling back on heapsort), moving it back into the range.
+ *
+ * There are four buckets per thread (up to `kSampleSortMaxBuckets`), so that
+ * a few oversized buckets don't hold up the whole sort. Ranges too short to
+ * be worth splitting are sorted on the calling thread. The sort is not stable.
+ *
+ * Expected performance: Theta(n lg n) work, O(n / p lg n) span
+ *
+ * @param first         Iterator to the first item to be sorted.
+ * @param last          Iterator after the last item to be sorted.
+ * @param pool          Pool to run the sort on.
+ * @param grain_size    Ranges of at most this many items are sorted
+ *      sequentially.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+void SampleSort(
+        RandomIt first, RandomIt last, ThreadPool &pool,
+        const int grain_size = kDefaultParallelGrainSize,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::value_type Item;
+    typedef typename std::decay<decltype(proj(*first))>::type Key;
+
+    auto size = last - first;
+    int num_buckets = std::min(4 * pool.NumThreads(), kSampleSortMaxBuckets);
+    if (size <= std::max(grain_size, kSampleSortOversampling * num_buckets)) {
+        IntroSort(first, last, comp, proj);
+        return;
+    }
+
+    // Choose splitters from a sorted random sample
+    std::vector<Item> sample = RandomlySample(
+        first, last, kSampleSortOversampling * num_buckets);
+    IntroSort(sample.begin(), sample.end(), comp, proj);
+    std::vector<Key> splitters;
+    for (int b = 1; b < num_buckets; ++b)
+        splitters.push_back(proj(sample[b * kSampleSortOversampling - 1]));
+    SplitterTree<Key, Compare> tree(splitters, comp);
+
+    std::vector<Item> buffer(size);
+    SharedMemoryBucketExchange exchange(pool);
+    std::vector<std::size_t> bucket_begin = exchange.Exchange(
+        std::make_move_iterator(first), std::make_move_iterator(last),
+        buffer.begin(), tree.NumBuckets(),
+        [&tree, &proj](const Item &item) {
+            return tree.Classify(proj(item));
+        });
+
+    TaskGroup group(pool);
+    for (int b = 0; b < tree.NumBuckets(); ++b) {
+        if (bucket_begin[b] == bucket_begin[b + 1])
+            continue;
+        group.Run([=, &buffer, &bucket_begin, &comp, &proj]() {
+            auto bucket_first = buffer.begin() + bucket_begin[b];
+            auto bucket_last = buffer.begin() + bucket_begin[b + 1];
+            IntroSort(bucket_first, bucket_last, comp, proj);
+            std::move(bucket_first, bucket_last, first + bucket_begin[b]);
+        });
+    }
+    group.Wait();
+}
+
+/** Sort the vector (in-place) in ascending order, using parallel sample sort.
+ *
+ * @param vec           Vector to be sorted.
+ * @param num_threads   Number of threads to sort with; 0 means one per core.
+ */
+void SampleSort(std::vector<int> &vec, const int num_threads = 0);
+
+#endif //ALGORITHMS_STUDY_CPP_SAMPLE_SORT_HPP
@@ -5,23 +5,38 @@
 #define ALGORITHMS_STUDY_CPP_SEARCHING_H
 
 #include <tuple>
+#include <vector>
 
+#include "algorithm/vector/binary_search.hpp"
+#include "algorithm/vector/max_subarray.hpp"
+#include "algorithm/vector/min_max.hpp"
+#include "algorithm/vector/select.hpp"
+#include "algorithm/vector/vectorized_scan.hpp"
+
+
+/** Index returned by the searches that do not throw when the value is not
+ *  found.
+ */
+const int kNotFound = -1;
 
 /** Search the vector for a value, return index if found.
  *
- *  Uses the "linear search" algorithm.
+ *  Uses the "linear search" algorithm, scanning a SIMD register of ints per
+ *  compare where the CPU has them (see `VectorizedFind`).
  *  Worst-case performance: O(n)
  *
  * @param   vec     Vector to be searched
  * @param   value   Value to be searched for
- * @return          Index that the value was found at.
- *          If value was not found, exception is thrown.
+ * @return          Index of the first item equal to the value.
+ *          If value was not found, `kNotFound`.
  */
 int LinearSearch(const std::vector<int> &vec, const int value);
 
 /** Find the index of the minimum value in a vector.
  *
  *  If there are two or more minima, the index of the first is returned.
+ *  Scans a SIMD register of ints per compare where the CPU has them (see
+ *  `VectorizedMinElement`).
  *  Worst-case performance: O(n)
  *
  * @param   vec         Vector to be searched.
@@ -33,6 +48,8 @@ int MinIndex(const std::vector<int> &vec, const int begin_index = 0);
 /** Find the index of the maximum value in a vector.
  *
  *  If there are two or more maxima, the index of the first is returned.
+ *  Scans a SIMD register of ints per compare where the CPU has them (see
+ *  `VectorizedMaxElement`).
  *  Worst-case performance: O(n)
  *
  *  Note that this is isomorphic to the "hiring problem" in the algorithms book.
@@ -43,6 +60,20 @@ int MinIndex(const std::vector<int> &vec, const int begin_index = 0);
  */
 int MaxIndex(const std::vector<int> &vec, const int begin_index = 0);
 
+/** Find the indices of the minimum and maximum values in a vector.
+ *
+ *  Finds both in one pass, along the lines of `MinIndex` and `MaxIndex`:
+ *  if there are two or more minima (or maxima), the index of the first is
+ *  returned. See `VectorizedStatistics`.
+ *  Worst-case performance: O(n)
+ *
+ * @param   vec         Vector to be searched.
+ * @param   begin_index Searching begins at this index.
+ * @return              2-tuple of the indices of the minimum and maximum.
+ */
+std::tuple<int, int> MinMaxIndex(
+        const std::vector<int> &vec, const int begin_index = 0);
+
 /** Find the index of the relative maximum value in a vector.
  *
  *  This returns the first value larger than the values before `begin_index`;
@@ -58,10 +89,74 @@ int MaxIndex(const std::vector<int> &vec, const int begin_index = 0);
  */
 int RelativeMaxIndex(const std::vector<int> &vec, const int begin_index);
 
+/** Return the `i`-th smallest item of the vector (0 for the minimum).
+ *
+ *  The vector is rearranged as by `NthElement`: introselect, which uses
+ *  random pivots and falls back to median of medians ones.
+ *  Worst-case performance: Theta(n)
+ *
+ * @param   vec     Vector to be searched; it is rearranged.
+ * @param   i       Order statistic wanted; must be less than `vec.size()`.
+ * @return          The item that would be at index `i` if it were sorted.
+ */
+int Select(std::vector<int> &vec, const int i);
+
+/** Return the `i`-th smallest item of the vector, using random pivots only.
+ *
+ *  See the generic `RandomizedSelect`.
+ *  Worst-case performance: Theta(n^2)
+ *  Average-case performance: Theta(n)
+ *
+ * @param   vec     Vector to be searched; it is rearranged.
+ * @param   i       Order statistic wanted; must be less than `vec.size()`.
+ * @return          The item that would be at index `i` if it were sorted.
+ */
+int RandomizedSelect(std::vector<int> &vec, const int i);
+
+/** Return the `i`-th smallest item of the vector, using median of medians
+ *  pivots only.
+ *
+ *  See the generic `DeterministicSelect`.
+ *  Worst-case performance: Theta(n)
+ *
+ * @param   vec     Vector to be searched; it is rearranged.
+ * @param   i       Order statistic wanted; must be less than `vec.size()`.
+ * @return          The item that would be at index `i` if it were sorted.
+ */
+int DeterministicSelect(std::vector<int> &vec, const int i);
+
+/** Return the `i`-th smallest item of the vector, using the Floyd–Rivest
+ *  algorithm.
+ *
+ *  See the generic `FloydRivestSelect`.
+ *  Worst-case performance: Theta(n^2)
+ *  Average-case performance: Theta(n)
+ *
+ * @param   vec     Vector to be searched; it is rearranged.
+ * @param   i       Order statistic wanted; must be less than `vec.size()`.
+ * @return          The item that would be at index `i` if it were sorted.
+ */
+int FloydRivestSelect(std::vector<int> &vec, const int i);
+
+/** Return the given quantiles of the vector's items.
+ *
+ *  Quantile q is the item at index `floor(q * (n - 1))` of the sorted
+ *  vector (the "lower" quantile; no interpolation). All of them are found
+ *  in one pass of `MultiSelect`.
+ *  Worst-case performance: O(n log q), for q quantiles
+ *
+ * @param   vec         Non-empty vector to be searched; it is rearranged.
+ * @param   quantiles   Quantiles wanted, each in [0, 1], in any order.
+ * @return              The quantiles' items, in the order they were asked.
+ */
+std::vector<int> Quantiles(
+        std::vector<int> &vec, const std::vector<double> &quantiles);
+
 /** Search a sorted vector for a value; return index if found; else throw.
  *
  *  Note that the input vector must be sorted; if it isn't, errors can occur.
- *  Recursive algorithm.
+ *  Iterative algorithm (see `LowerBound`); if the value appears more than
+ *  once, the index of the first is returned.
  *  Throws an exception if index is not found.
  *
  *  Worst-case performance: Theta(log n)
@@ -76,6 +171,53 @@ int BinarySearch(
         const std::vector<int> &vec, const int begin_index, const int end_index,
         const int value);
 
+/** Return the index of the first item of a sorted vector not less than the
+ *  value (the vector's size if there is none).
+ *
+ *  Branchless and prefetching; see the generic `LowerBound`.
+ *  Worst-case performance: Theta(log n)
+ *
+ * @param vec       Vector to be searched, in ascending order.
+ * @param value     Value to be searched for.
+ * @return          Index the value would be inserted at, before any equal.
+ */
+int LowerBound(const std::vector<int> &vec, const int value);
+
+/** Return the index of the first item of a sorted vector greater than the
+ *  value (the vector's size if there is none).
+ *
+ *  Worst-case performance: Theta(log n)
+ *
+ * @param vec       Vector to be searched, in ascending order.
+ * @param value     Value to be searched for.
+ * @return          Index the value would be inserted at, after any equal.
+ */
+int UpperBound(const std::vector<int> &vec, const int value);
+
+/** Return the range of indices of a sorted vector holding the value.
+ *
+ *  Worst-case performance: Theta(log n)
+ *
+ * @param vec       Vector to be searched, in ascending order.
+ * @param value     Value to be searched for.
+ * @return          2-tuple of the `LowerBound` and `UpperBound` indices; they
+ *          are equal if the value is not in the vector.
+ */
+std::tuple<int, int> EqualRange(const std::vector<int> &vec, const int value);
+
+/** Return the `LowerBound` index of each of many values in a sorted vector.
+ *
+ *  The searches are interleaved to overlap their cache misses (see
+ *  `BatchedLowerBound`).
+ *  Worst-case performance: Theta(m log n), for m values
+ *
+ * @param vec       Vector to be searched, in ascending order.
+ * @param values    Values to be searched for.
+ * @return          The index for each value, in the same order.
+ */
+std::vector<int> BatchedLowerBound(
+        const std::vector<int> &vec, const std::vector<int> &values);
+
 /** Search vector for the "crossing" congruent subvector with the largest sum.
  *
  *  A subvector is said to be "crossing" if it includes the two items straddling
@@ -94,7 +236,7 @@ int BinarySearch(
  *          3. Sum of the result subvector.
  */
 std::tuple<int, int, int> FindMaxCrossingSubvector(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int middle_index,
         const int end_index);
@@ -115,7 +257,7 @@ std::tuple<int, int, int> FindMaxCrossingSubvector(
  *          3. Sum of the result subvector.
  */
 std::tuple<int, int, int> FindMaxSubvectorDAC(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int end_index);
 
@@ -134,7 +276,7 @@ std::tuple<int, int, int> FindMaxSubvectorDAC(
  *          3. Sum of the result subvector.
  */
 std::tuple<int, int, int> FindMaxSubvectorBF(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int end_index);
 
@@ -153,8 +295,37 @@ std::tuple<int, int, int> FindMaxSubvectorBF(
  *          3. Sum of the result subvector.
  */
 std::tuple<int, int, int> FindMaxSubvector(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int end_index);
 
+/** Search vector for the congruent subvector with the largest sum, in
+ *  parallel.
+ *
+ *  The range is split into pieces that are summarized (total, best prefix,
+ *  best suffix and best subvector) on separate threads, and the summaries
+ *  combined; see `ParallelSummarizeSubarrays`. Of subvectors with the same
+ *  sum, the first to begin (then to end) is returned.
+ *
+ *  Worst-case performance: Theta(n) work
+ *
+ * @param   vec         Vector to be searched
+ * @param   begin_index First index in the search range.
+ * @param   end_index   Index after the last index in the search range.
+ * @param   num_threads Number of threads to search with; 0 means one per
+ *                      core.
+ * @param   grain_size  Pieces of at most this many items are summarized
+ *                      sequentially.
+ * @returns             `std::tuple` with three items:
+ *          1. Beginning index of the result subvector.
+ *          2. Index after the ending index of the result subvector.
+ *          3. Sum of the result subvector (which may not fit in an int).
+ */
+std::tuple<int, int, long long> ParallelFindMaxSubvector(
+        const std::vector<int> &vec,
+        const int begin_index,
+        const int end_index,
+        const int num_threads = 0,
+        const int grain_size = kMaxSubarrayGrainSize);
+
 #endif //ALGORITHMS_STUDY_CPP_SEARCHING_H
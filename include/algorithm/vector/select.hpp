@@ -0,0 +1,263 @@
+/** Selection: the i-th smallest item of a range (its i-th order statistic).
+ *
+ * Several algorithms for one item, and a multi-select that finds many order
+ * statistics (say the quantiles of a sample) in one recursive pass. They
+ * partition with `PartitionScheme::kVectorized`, so on ints the scans run in
+ * SIMD registers where the CPU has them.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_SELECT_HPP
+#define ALGORITHMS_STUDY_CPP_SELECT_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "algorithm/vector/generic_sort.hpp"
+#include "algorithm/vector/partial_sort.hpp"
+
+
+/** Ranges longer than this are narrowed down by Floyd–Rivest sampling before
+ * they are partitioned.
+ */
+const int kFloydRivestSampleCutoff = 600;
+
+/** Rearrange the range so the item at `nth` is the one that would be there
+ * if the range were sorted, with random pivots only (quickselect).
+ *
+ * Each step partitions around a random item with
+ * `RandomizedQuicksortPartition` and carries on in the side holding `nth`.
+ *
+ * Worst-case performance: Theta(n^2)
+ * Average-case performance: Theta(n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param nth   Iterator to the position to be filled with its sorted item.
+ * @param last  Iterator after the last item of the range.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      `nth`.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt RandomizedSelect(
+        RandomIt first, RandomIt nth, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    if (nth != last)
+        detail::SelectLoop(
+            first, nth, last, std::numeric_limits<Index>::max(), comp, proj);
+    return nth;
+}
+
+/** Rearrange the range so the item at `nth` is the one that would be there
+ * if the range were sorted, with median of medians pivots only (BFPRT).
+ *
+ * Slower than random pivots on average, but linear whatever the input.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param nth   Iterator to the position to be filled with its sorted item.
+ * @param last  Iterator after the last item of the range.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      `nth`.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt DeterministicSelect(
+        RandomIt first, RandomIt nth, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    if (nth != last)
+        detail::SelectLoop(first, nth, last, 0, comp, proj);
+    return nth;
+}
+
+namespace detail {
+
+/** Floyd–Rivest selection of `nth` in `[first + left, first + right]`. */
+template <typename RandomIt, typename Compare, typename Projection>
+void FloydRivestLoop(
+        RandomIt first,
+        typename std::iterator_traits<RandomIt>::difference_type left,
+        typename std::iterator_traits<RandomIt>::difference_type nth,
+        typename std::iterator_traits<RandomIt>::difference_type right,
+        Compare &comp, Projection &proj) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type Index;
+    while (right > left) {
+        if (right - left > kFloydRivestSampleCutoff) {
+            // Select from a sample of about n^(2/3) items first, so `nth`'s
+            // item most likely lands between two close bounds that then
+            // make good pivots
+            double n = right - left + 1;
+            double i = nth - left + 1;
+            double z = std::log(n);
+            double s = 0.5 * std::exp(2 * z / 3);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) *
+                        (i < n / 2 ? -1 : 1);
+            Index new_left = std::max(
+                left, (Index)std::floor(nth - i * s / n + sd));
+            Index new_right = std::min(
+                right, (Index)std::floor(nth + (n - i) * s / n + sd));
+            FloydRivestLoop(first, new_left, nth, new_right, comp, proj);
+        }
+
+        // Hoare partition around the item now at `nth`, with the range's
+        // ends as sentinels
+        typename std::iterator_traits<RandomIt>::value_type pivot =
+            *(first + nth);
+        Index i = left;
+        Index j = right;
+        SwapItems(first + left, first + nth);
+        if (ProjectedLess(comp, proj, pivot, *(first + right)))
+            SwapItems(first + right, first + left);
+        while (i < j) {
+            SwapItems(first + i, first + j);
+            ++i;
+            --j;
+            while (ProjectedLess(comp, proj, *(first + i), pivot))
+                ++i;
+            while (ProjectedLess(comp, proj, pivot, *(first + j)))
+                --j;
+        }
+        // The pivot went to whichever end holds an item equivalent to it
+        if (!ProjectedLess(comp, proj, *(first + left), pivot) &&
+                !ProjectedLess(comp, proj, pivot, *(first + left))) {
+            SwapItems(first + left, first + j);
+        }
+        else {
+            ++j;
+            SwapItems(first + j, first + right);
+        }
+
+        if (j <= nth)
+            left = j + 1;
+        if (nth <= j)
+            right = j - 1;
+    }
+}
+
+} // namespace detail
+
+/** Rearrange the range so the item at `nth` is the one that would be there
+ * if the range were sorted, with the Floyd–Rivest algorithm.
+ *
+ * Long ranges are first narrowed by selecting (recursively) from a sample of
+ * the items around `nth`, which most likely brackets `nth`'s item; the
+ * partition around them then leaves only a short range to finish, so it
+ * takes about n + min(i, n - i) comparisons, close to the lower bound.
+ *
+ * Worst-case performance: Theta(n^2)
+ * Average-case performance: Theta(n)
+ *
+ * @param first Iterator to the first item of the range.
+ * @param nth   Iterator to the position to be filled with its sorted item.
+ * @param last  Iterator after the last item of the range.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      `nth`.
+ */
+template <typename RandomIt, typename Compare = Less,
+          typename Projection = Identity>
+RandomIt FloydRivestSelect(
+        RandomIt first, RandomIt nth, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    if (nth != last)
+        detail::FloydRivestLoop(
+            first, 0, nth - first, (last - first) - 1, comp, proj);
+    return nth;
+}
+
+namespace detail {
+
+/** Multi-select the ranks in `[rank_first, rank_last)` (offsets from `base`)
+ * that fall in `[first, last)`.
+ */
+template <typename RandomIt, typename RankIt, typename Compare,
+          typename Projection>
+void MultiSelectLoop(
+        RandomIt base, RandomIt first, RandomIt last,
+        RankIt rank_first, RankIt rank_last,
+        Compare &comp, Projection &proj) {
+    const int leaf_size = LeafSize(first, comp, proj, kSelectInsertionCutoff);
+    auto work_budget = kIntroselectWorkFactor * (last - first);
+    while (rank_first != rank_last) {
+        auto size = last - first;
+        if (size <= leaf_size) {
+            SortSmallRange(first, last, comp, proj);
+            return;
+        }
+        if (rank_last - rank_first == 1) {
+            NthElement(first, base + *rank_first, last, comp, proj);
+            return;
+        }
+
+        RandomIt split;
+        if (work_budget >= size) {
+            work_budget -= size;
+            split = RandomizedQuicksortPartition(
+                first, last, comp, proj, PartitionScheme::kVectorized);
+        }
+        else {
+            SwapItems(MedianOfMediansPivot(first, last, comp, proj), last - 1);
+            split = QuicksortPartition(
+                first, last, comp, proj, true, PartitionScheme::kVectorized);
+        }
+
+        // Every rank is found on the side of the pivot it falls on
+        auto split_rank = split - base;
+        RankIt left_end = std::lower_bound(rank_first, rank_last, split_rank);
+        RankIt right_begin = std::upper_bound(left_end, rank_last, split_rank);
+        if (left_end != rank_first) {
+            // The left side holds the items equivalent to the pivot too
+            RandomIt equal_begin = QuicksortPartition(
+                first, split + 1, comp, proj, false,
+                PartitionScheme::kVectorized);
+            MultiSelectLoop(
+                base, first, equal_begin, rank_first,
+                std::lower_bound(rank_first, left_end, equal_begin - base),
+                comp, proj);
+        }
+        first = split + 1;
+        rank_first = right_begin;
+    }
+}
+
+} // namespace detail
+
+/** Rearrange the range so each of the given positions holds the item that
+ * would be there if the range were sorted.
+ *
+ * Each partition splits the wanted ranks between its two sides, and only
+ * sides with ranks left in them are partitioned further, so q ranks take
+ * one recursive pass of O(n log q) work instead of q selections. The items
+ * between two consecutive ranks end up between their items.
+ *
+ * Worst-case performance: O(n log q), for q ranks
+ *
+ * @param first         Iterator to the first item of the range.
+ * @param last          Iterator after the last item of the range.
+ * @param rank_first    Iterator to the first rank (offset from `first`).
+ * @param rank_last     Iterator after the last rank; the ranks must be in
+ *                      ascending order, and less than `last - first`.
+ * @param comp          Strict weak ordering of the projected items.
+ * @param proj          Projection applied to items before comparing them.
+ */
+template <typename RandomIt, typename RankIt, typename Compare = Less,
+          typename Projection = Identity>
+void MultiSelect(
+        RandomIt first, RandomIt last, RankIt rank_first, RankIt rank_last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    assert(std::is_sorted(rank_first, rank_last) &&
+           "Ranks must be in ascending order!");
+    assert((rank_first == rank_last || *(rank_last - 1) < last - first) &&
+           "Ranks must be within the range!");
+    detail::MultiSelectLoop(
+        first, first, last, rank_first, rank_last, comp, proj);
+}
+
+#endif //ALGORITHMS_STUDY_CPP_SELECT_HPP
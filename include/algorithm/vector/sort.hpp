@@ -1,9 +1,21 @@
 /** Sorting functions.
+ *
+ * The functions here work on `std::vector<int>`; generic versions over any
+ * random-access range, comparator and projection are in `generic_sort.hpp`
+ * (and `radix_sort.hpp`).
  */
 
 #ifndef ALGORITHMS_STUDY_CPP_SORTING_H
 #define ALGORITHMS_STUDY_CPP_SORTING_H
 
+#include <tuple>
+#include <vector>
+
+#include "algorithm/vector/generic_sort.hpp"
+#include "algorithm/vector/partial_sort.hpp"
+#include "algorithm/vector/radix_sort.hpp"
+#include "algorithm/vector/sort_by_key.hpp"
+
 
 /** Insert value into correct place in sorted vector.
  *
@@ -95,6 +107,69 @@ void MergeSortedSubvectors(
 void MergeSort(
         std::vector<int> &vec, const int begin_index, const int end_index);
 
+/** Sort the vector (in-place) in ascending order.
+ *
+ *  Uses a merge sort that allocates a single scratch buffer up-front, and then
+ *  merges back and forth between the vector and the buffer ("ping-pong")
+ *  instead of copying each pair of subvectors out before merging them. Merges
+ *  are bounds-checked, so no sentinel value is needed.
+ *
+ *  Worst-case performance: O(n log n)
+ *
+ * @param vec           Vector to be sorted
+ * @param begin_index   Index of the first item to be merge-sorted.
+ * @param end_index     Index after the last item to be merge-sorted.
+ */
+void BufferedMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index);
+
+/** Sort the vector (in-place) in ascending order, reusing a scratch buffer.
+ *
+ *  Like the other `BufferedMergeSort`, but uses the caller's scratch vector,
+ *  which is only grown if it is smaller than the subvector being sorted. When
+ *  the same scratch vector is reused, sorting allocates no memory at all.
+ *
+ *  Worst-case performance: O(n log n)
+ *
+ * @param vec           Vector to be sorted
+ * @param begin_index   Index of the first item to be merge-sorted.
+ * @param end_index     Index after the last item to be merge-sorted.
+ * @param scratch       Scratch space; its contents are overwritten.
+ */
+void BufferedMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index,
+        std::vector<int> &scratch);
+
+/** Sort the subvector (in-place) in ascending order.
+ *
+ * Uses bottom-up merge sort merging `kMultiwayMergeSortWays` runs at a time
+ * (see `MultiwayMergeSortWithBuffer`), so it makes fewer passes over the
+ * data than the two-way merge sorts.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param vec           Vector to be sorted
+ * @param begin_index   Index of the first item to be merge-sorted.
+ * @param end_index     Index after the last item to be merge-sorted.
+ */
+void MultiwayMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index);
+
+/** Sort the subvector (in-place) in ascending order.
+ *
+ * Uses adaptive merge sort (see the generic `AdaptiveMergeSort`), which
+ * merges the runs already present, so nearly sorted input sorts in close to
+ * linear time.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param vec           Vector to be sorted
+ * @param begin_index   Index of the first item to be merge-sorted.
+ * @param end_index     Index after the last item to be merge-sorted.
+ */
+void AdaptiveMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index);
+
 /** Sort the vector (in-place) in ascending order.
  *
  * Uses the "heapsort" algorithm.
@@ -126,10 +201,35 @@ void HeapSort(std::vector<int> &vec);
  *      partitioned
  * @param equality_check    If true, the left partition will contain items
  *      equal to the pivot. Otherwise, they will be in right partition.
+ * @param scheme            How items are moved around the pivot (see
+ *      `PartitionScheme`)
  * @return                  Index of the item dividing the partitions (the
  *      'pivot')
  */
 int QuicksortPartition(
+        std::vector<int> &vec, const int begin, const int end,
+        const bool equality_check = true,
+        const PartitionScheme scheme = PartitionScheme::kLomuto);
+
+/** Rearrange the subvector (in-place), partitioning it for quicksort with SIMD.
+ *
+ * Same as `QuicksortPartition` with `PartitionScheme::kVectorized`: AVX-512
+ * or AVX2 compares and packed stores where the CPU has them, and the scalar
+ * block partition otherwise.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param vec               Vector containing the subvector to be partitioned
+ * @param begin_index       Index of the first item in the subvector to be
+ *      partitioned
+ * @param end_index         Index after the last item in the subvector to be
+ *      partitioned
+ * @param equality_check    If true, the left partition will contain items
+ *      equal to the pivot. Otherwise, they will be in right partition.
+ * @return                  Index of the item dividing the partitions (the
+ *      'pivot')
+ */
+int VectorizedQuicksortPartition(
         std::vector<int> &vec, const int begin, const int end,
         const bool equality_check = true);
 
@@ -157,6 +257,26 @@ int QuicksortPartition(
 std::tuple<int, int> EqCheckQuicksortPartition(
         std::vector<int> &vec, const int begin, const int end);
 
+/** Rearrange the subvector (in-place) into three partitions, in one pass.
+ *
+ * Uses the first item in the subvector as a 'pivot', and partitions the
+ * subvector into elements less than, equal to and greater than it, with
+ * Bentley and McIlroy's single-pass scheme.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param vec           Vector containing the subvector to be partitioned
+ * @param begin_index   Index of the first item in the subvector to be
+ *          partitioned
+ * @param end_index     Index after the last item in the subvector to be
+ *          partitioned
+ * @return              2-tuple containing:
+ * 1. the index marking the beginning of the 'equal to pivot' partition
+ * 2. the index that is one after the end of the 'equal to pivot' partition.
+ */
+std::tuple<int, int> ThreeWayQuicksortPartition(
+        std::vector<int> &vec, const int begin, const int end);
+
 /** Rearrange the subvector (in-place), partitioning it randomly for quicksort.
  *
  * Uses a random item in subvector as a 'pivot', and partitions the subvector
@@ -216,31 +336,38 @@ int HoareQuicksortPartition(
 
 /** Sort the vector (in-place) in ascending order.
  *
- * Uses the quicksort recursive algorithm.
+ * Uses the quicksort recursive algorithm, partitioning with the given scheme.
  *
  * Worst-case performance: Theta(n^2)
  * Average-case performance: Theta(n lg n)
  */
-void Quicksort(std::vector<int> &vec, const int begin, const int end);
+void Quicksort(
+        std::vector<int> &vec, const int begin, const int end,
+        const PartitionScheme scheme = PartitionScheme::kLomuto);
 
 /** Sort the vector (in-place) in ascending order.
  *
- * Uses the randomized quicksort recursive algorithm.
+ * Uses the randomized quicksort recursive algorithm, partitioning with the
+ * given scheme.
  *
  * Worst-case performance: Theta(n^2)
  * Average-case performance: Theta(n lg n)
  */
-void RandomizedQuicksort(std::vector<int> &vec, const int begin, const int end);
+void RandomizedQuicksort(
+        std::vector<int> &vec, const int begin, const int end,
+        const PartitionScheme scheme = PartitionScheme::kLomuto);
 
 /** Sort the vector (in-place) in ascending order.
  *
- * Uses the randomized equality-checking quicksort recursive algorithm.
+ * Uses the randomized equality-checking quicksort recursive algorithm,
+ * partitioning with the given scheme.
  *
  * Worst-case performance: Theta(n^2)
  * Average-case performance: Theta(n lg n)
  */
 void RandomizedEqCheckQuicksort(
-        std::vector<int> &vec, const int begin, const int end);
+        std::vector<int> &vec, const int begin, const int end,
+        const PartitionScheme scheme = PartitionScheme::kLomuto);
 
 /** Sort the vector (in-place) in ascending order.
  *
@@ -251,6 +378,26 @@ void RandomizedEqCheckQuicksort(
  */
 void HoareQuicksort(std::vector<int> &vec, const int begin, const int end);
 
+/** Sort the vector (in-place) in ascending order.
+ *
+ * Uses the introsort hybrid algorithm: quicksort with median-of-three pivots,
+ * finishing short subvectors with insertion sort and falling back to heapsort
+ * when the recursion gets too deep.
+ *
+ * Worst-case performance: Theta(n lg n)
+ */
+void IntroSort(std::vector<int> &vec, const int begin, const int end);
+
+/** Sort the vector (in-place) in ascending order.
+ *
+ * Uses three-way (Bentley–McIlroy) quicksort, which partitions out the items
+ * equal to the pivot at every level, so it takes O(n lg d) time for d
+ * distinct values.
+ *
+ * Worst-case performance: Theta(n lg n)
+ */
+void ThreeWayQuicksort(std::vector<int> &vec, const int begin, const int end);
+
 /** Return sorted version of input vector using counting sort.
  *
  * Uses the counting sort algorithm.
@@ -264,5 +411,100 @@ void HoareQuicksort(std::vector<int> &vec, const int begin, const int end);
 std::vector<int> CountingSort(
         std::vector<int> &input_vec, const int min, const int max);
 
+/** Return sorted version of input vector using counting sort.
+ *
+ * Like the overload above, but finds the smallest and largest values itself,
+ * in one SIMD pass (see `VectorizedStatistics`). If they are too far apart
+ * for a histogram (see `kCountingSortMaxRangePerItem`), it radix sorts a
+ * copy instead.
+ *
+ * @param input_vec Vector to be sorted
+ *
+ * @return          Sorted input vector
+ */
+std::vector<int> CountingSort(std::vector<int> &input_vec);
+
+/** Sort the vector (in-place) in ascending order.
+ *
+ * Uses least-significant-digit radix sort, so unlike counting sort it works
+ * on the full range of int values. Needs a scratch copy of the vector.
+ *
+ * Worst-case performance: Theta(n)
+ */
+void LsdRadixSort(std::vector<int> &vec);
+
+/** Sort the vector (in-place) in ascending order.
+ *
+ * Uses in-place most-significant-digit radix sort ("American flag sort"),
+ * which needs no scratch copy of the vector.
+ *
+ * Worst-case performance: Theta(n)
+ */
+void AmericanFlagSort(std::vector<int> &vec);
+
+/** Sort the `k` smallest items of the vector (in-place) into its first `k`
+ * positions, in ascending order.
+ *
+ * The other items end up after them, in unspecified order. See the generic
+ * `PartialSort`.
+ *
+ * Worst-case performance: O(n log k)
+ *
+ * @param vec   Vector to be partially sorted.
+ * @param k     Number of smallest items to be sorted (at most `vec.size()`).
+ */
+void PartialSort(std::vector<int> &vec, const int k);
+
+/** Rearrange the vector (in-place) so `vec[n]` holds the item that would be
+ * there if the vector were sorted.
+ *
+ * Items before it are not greater, and items after it not smaller. Uses
+ * introselect (see the generic `NthElement`).
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param vec   Vector to be rearranged.
+ * @param n     Index of the order statistic wanted (0 for the minimum).
+ */
+void NthElement(std::vector<int> &vec, const int n);
+
+/** Return the `k` largest items of the vector, largest first.
+ *
+ * Keeps a min-heap of the `k` largest items seen (see `TopKHeap`).
+ *
+ * Worst-case performance: O(n log k)
+ *
+ * @param vec   Vector of items.
+ * @param k     Number of largest items wanted.
+ * @return      The (at most) `k` largest items, in descending order.
+ */
+std::vector<int> TopK(const std::vector<int> &vec, const int k);
+
+/** Return the permutation that sorts the vector in ascending order.
+ *
+ * Item `vec[result[i]]` is the `i`-th smallest; equal items keep their
+ * order. Uses LSD radix sort on the keys and their indices (see
+ * `RadixArgSort`).
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param vec   Vector whose sorting permutation is wanted.
+ * @return      Indices of the items, in sorted order.
+ */
+std::vector<int> ArgSort(const std::vector<int> &vec);
+
+/** Sort the keys (in-place) in ascending order, moving the values with them.
+ *
+ * Uses LSD radix sort over the two vectors (see `RadixSortByKey`); equal
+ * keys keep their order.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param keys      Keys to be sorted.
+ * @param values    The value of each key.
+ * @throws std::runtime_error if the vectors differ in length.
+ */
+void SortByKey(std::vector<int> &keys, std::vector<int> &values);
+
 #endif //ALGORITHMS_STUDY_CPP_SORTING_H
 
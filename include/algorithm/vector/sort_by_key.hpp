@@ -0,0 +1,407 @@
+/** Sorting keys together with separate values, and argsort.
+ *
+ * The keys and values stay in two separate ranges (structure of arrays):
+ * the sorts see them through an iterator over (key, value) pairs that reads
+ * only the key when comparing, and moves a key and its value together. So
+ * the comparisons only touch the dense key array, no array of (key, value)
+ * structs is ever built, and the values are moved, never copied (but for a
+ * pivot the quicksort holds).
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_SORT_BY_KEY_HPP
+#define ALGORITHMS_STUDY_CPP_SORT_BY_KEY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "algorithm/counters.hpp"
+#include "algorithm/vector/generic_sort.hpp"
+#include "algorithm/vector/radix_sort.hpp"
+
+
+namespace detail {
+
+/** A key and its value, referred to in their two ranges.
+ *
+ * Assigning to it assigns the key and the value. The sorts only ever move
+ * items from one place to another, and `*it` is a temporary reference, so
+ * assigning a temporary reference moves the items (as does `IterMove`, which
+ * moves them out into a (key, value) pair); assigning a named one copies
+ * them. It converts to a (key, value) pair by copying, which is what holding
+ * an item (e.g. a pivot) takes.
+ */
+template <typename KeyIt, typename ValueIt>
+class KeyValueReference {
+public:
+    typedef typename std::iterator_traits<KeyIt>::value_type Key;
+    typedef typename std::iterator_traits<ValueIt>::value_type Value;
+    typedef std::pair<Key, Value> Item;
+
+    KeyValueReference(const KeyIt key, const ValueIt value)
+        : key_(key), value_(value) {}
+
+    KeyValueReference(const KeyValueReference &other) = default;
+
+    KeyValueReference &operator=(const KeyValueReference &other) {
+        *key_ = *other.key_;
+        *value_ = *other.value_;
+        return *this;
+    }
+
+    KeyValueReference &operator=(KeyValueReference &&other) {
+        *key_ = std::move(*other.key_);
+        *value_ = std::move(*other.value_);
+        return *this;
+    }
+
+    KeyValueReference &operator=(Item &&item) {
+        *key_ = std::move(item.first);
+        *value_ = std::move(item.second);
+        return *this;
+    }
+
+    KeyValueReference &operator=(const Item &item) {
+        *key_ = item.first;
+        *value_ = item.second;
+        return *this;
+    }
+
+    operator Item() const {
+        return Item(*key_, *value_);
+    }
+
+    const Key &key() const { return *key_; }
+
+    /** Move the key and the value out into a (key, value) pair. */
+    Item MoveOut() const {
+        return Item(std::move(*key_), std::move(*value_));
+    }
+
+    friend void swap(KeyValueReference a, KeyValueReference b) {
+        using std::swap;
+        swap(*a.key_, *b.key_);
+        swap(*a.value_, *b.value_);
+    }
+
+private:
+    KeyIt key_;
+    ValueIt value_;
+};
+
+/** Random-access iterator over the (key, value) pairs of two ranges.
+ */
+template <typename KeyIt, typename ValueIt>
+class KeyValueIterator {
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef typename KeyValueReference<KeyIt, ValueIt>::Item value_type;
+    typedef typename std::iterator_traits<KeyIt>::difference_type
+        difference_type;
+    typedef void pointer;
+    typedef KeyValueReference<KeyIt, ValueIt> reference;
+
+    KeyValueIterator() : key_(), value_() {}
+
+    KeyValueIterator(const KeyIt key, const ValueIt value)
+        : key_(key), value_(value) {}
+
+    reference operator*() const { return reference(key_, value_); }
+
+    reference operator[](const difference_type offset) const {
+        return reference(key_ + offset, value_ + offset);
+    }
+
+    KeyValueIterator &operator++() { ++key_; ++value_; return *this; }
+    KeyValueIterator &operator--() { --key_; --value_; return *this; }
+
+    KeyValueIterator operator++(int) {
+        KeyValueIterator old(*this);
+        ++*this;
+        return old;
+    }
+
+    KeyValueIterator operator--(int) {
+        KeyValueIterator old(*this);
+        --*this;
+        return old;
+    }
+
+    KeyValueIterator &operator+=(const difference_type offset) {
+        key_ += offset;
+        value_ += offset;
+        return *this;
+    }
+
+    KeyValueIterator &operator-=(const difference_type offset) {
+        return *this += -offset;
+    }
+
+    KeyValueIterator operator+(const difference_type offset) const {
+        return KeyValueIterator(key_ + offset, value_ + offset);
+    }
+
+    friend KeyValueIterator operator+(
+            const difference_type offset, const KeyValueIterator &it) {
+        return it + offset;
+    }
+
+    KeyValueIterator operator-(const difference_type offset) const {
+        return KeyValueIterator(key_ - offset, value_ - offset);
+    }
+
+    difference_type operator-(const KeyValueIterator &other) const {
+        return key_ - other.key_;
+    }
+
+    bool operator==(const KeyValueIterator &o) const { return key_ == o.key_; }
+    bool operator!=(const KeyValueIterator &o) const { return key_ != o.key_; }
+    bool operator<(const KeyValueIterator &o) const { return key_ < o.key_; }
+    bool operator>(const KeyValueIterator &o) const { return key_ > o.key_; }
+    bool operator<=(const KeyValueIterator &o) const { return key_ <= o.key_; }
+    bool operator>=(const KeyValueIterator &o) const { return key_ >= o.key_; }
+
+    friend value_type IterMove(const KeyValueIterator &it) {
+        return (*it).MoveOut();
+    }
+
+private:
+    KeyIt key_;
+    ValueIt value_;
+};
+
+template <typename KeyIt, typename ValueIt>
+KeyValueIterator<KeyIt, ValueIt> MakeKeyValueIterator(
+        const KeyIt key, const ValueIt value) {
+    return KeyValueIterator<KeyIt, ValueIt>(key, value);
+}
+
+/** Projection giving the key of a (key, value) pair or reference to one.
+ */
+struct PairKey {
+    template <typename KeyIt, typename ValueIt>
+    auto operator()(const KeyValueReference<KeyIt, ValueIt> &item) const
+            -> decltype(item.key()) {
+        return item.key();
+    }
+
+    template <typename Key, typename Value>
+    const Key &operator()(const std::pair<Key, Value> &item) const {
+        return item.first;
+    }
+};
+
+/** Copy the projected keys of the items into a vector. */
+template <typename RandomIt, typename Projection>
+std::vector<typename std::decay<
+    decltype(std::declval<Projection &>()(*std::declval<RandomIt>()))>::type>
+ProjectedKeys(RandomIt first, RandomIt last, Projection &proj) {
+    std::vector<typename std::decay<decltype(proj(*first))>::type> keys;
+    keys.reserve(last - first);
+    for (RandomIt item = first; item != last; ++item)
+        keys.push_back(proj(*item));
+    return keys;
+}
+
+} // namespace detail
+
+/** Sort keys by merge sort, moving the corresponding values along with them.
+ *
+ * `values` holds one value per key; after the sort, the value that was at
+ * the same position as a key is again at the same position as it. The sort
+ * is stable. The scratch space is two buffers, for the keys and the values.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param key_first     Iterator to the first key.
+ * @param key_last      Iterator after the last key.
+ * @param value_first   Iterator to the value of the first key.
+ * @param comp          Strict weak ordering of the keys.
+ */
+template <typename KeyIt, typename ValueIt, typename Compare = Less>
+void MergeSortByKey(
+        KeyIt key_first, KeyIt key_last, ValueIt value_first,
+        Compare comp = Compare()) {
+    std::vector<typename std::iterator_traits<KeyIt>::value_type> key_buffer(
+        key_last - key_first);
+    std::vector<typename std::iterator_traits<ValueIt>::value_type>
+        value_buffer(key_last - key_first);
+    MergeSortWithBuffer(
+        detail::MakeKeyValueIterator(key_first, value_first),
+        detail::MakeKeyValueIterator(key_last, value_first +
+                                     (key_last - key_first)),
+        detail::MakeKeyValueIterator(key_buffer.begin(), value_buffer.begin()),
+        comp, detail::PairKey());
+}
+
+/** Sort keys by introsort, moving the corresponding values along with them.
+ *
+ * Like `MergeSortByKey`, but sorts in place and is not stable.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param key_first     Iterator to the first key.
+ * @param key_last      Iterator after the last key.
+ * @param value_first   Iterator to the value of the first key.
+ * @param comp          Strict weak ordering of the keys.
+ */
+template <typename KeyIt, typename ValueIt, typename Compare = Less>
+void QuicksortByKey(
+        KeyIt key_first, KeyIt key_last, ValueIt value_first,
+        Compare comp = Compare()) {
+    IntroSort(
+        detail::MakeKeyValueIterator(key_first, value_first),
+        detail::MakeKeyValueIterator(key_last, value_first +
+                                     (key_last - key_first)),
+        comp, detail::PairKey());
+}
+
+/** Sort integer or floating-point keys by LSD radix sort, moving the
+ * corresponding values along with them.
+ *
+ * Like `MergeSortByKey`, but in ascending order only. The sort is stable.
+ *
+ * Worst-case performance: Theta(n w / d), for w-bit keys and d-bit digits
+ *
+ * @param key_first     Iterator to the first key.
+ * @param key_last      Iterator after the last key.
+ * @param value_first   Iterator to the value of the first key.
+ */
+template <typename KeyIt, typename ValueIt>
+void RadixSortByKey(KeyIt key_first, KeyIt key_last, ValueIt value_first) {
+    std::vector<typename std::iterator_traits<KeyIt>::value_type> key_buffer(
+        key_last - key_first);
+    std::vector<typename std::iterator_traits<ValueIt>::value_type>
+        value_buffer(key_last - key_first);
+    LsdRadixSortWithBuffer(
+        detail::MakeKeyValueIterator(key_first, value_first),
+        detail::MakeKeyValueIterator(key_last, value_first +
+                                     (key_last - key_first)),
+        detail::MakeKeyValueIterator(key_buffer.begin(), value_buffer.begin()),
+        detail::PairKey());
+}
+
+/** Return the permutation that sorts the range ("argsort").
+ *
+ * Item `result[i]` of the range is the `i`-th in sorted order. The projected
+ * keys are copied into a dense array first and sorted together with their
+ * indices (`MergeSortByKey`), so the items themselves are only read once.
+ * The permutation is stable: equivalent items keep their order.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first Iterator to the first item.
+ * @param last  Iterator after the last item.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Indices of the items, in sorted order (of type `Index`).
+ */
+template <typename Index = std::size_t, typename RandomIt,
+          typename Compare = Less, typename Projection = Identity>
+std::vector<Index> ArgSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto keys = detail::ProjectedKeys(first, last, proj);
+    std::vector<Index> indices(keys.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    MergeSortByKey(keys.begin(), keys.end(), indices.begin(), comp);
+    return indices;
+}
+
+/** Return the permutation that sorts the range, using introsort.
+ *
+ * Like `ArgSort`, but the order of equivalent items is unspecified.
+ *
+ * Worst-case performance: O(n log n)
+ *
+ * @param first Iterator to the first item.
+ * @param last  Iterator after the last item.
+ * @param comp  Strict weak ordering of the projected items.
+ * @param proj  Projection applied to items before comparing them.
+ * @return      Indices of the items, in sorted order (of type `Index`).
+ */
+template <typename Index = std::size_t, typename RandomIt,
+          typename Compare = Less, typename Projection = Identity>
+std::vector<Index> UnstableArgSort(
+        RandomIt first, RandomIt last,
+        Compare comp = Compare(), Projection proj = Projection()) {
+    auto keys = detail::ProjectedKeys(first, last, proj);
+    std::vector<Index> indices(keys.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    QuicksortByKey(keys.begin(), keys.end(), indices.begin(), comp);
+    return indices;
+}
+
+/** Return the permutation that sorts the range by integer or floating-point
+ * keys, in ascending order, using LSD radix sort.
+ *
+ * Like `ArgSort` (and stable too).
+ *
+ * Worst-case performance: Theta(n w / d), for w-bit keys and d-bit digits
+ *
+ * @param first Iterator to the first item.
+ * @param last  Iterator after the last item.
+ * @param proj  Projection giving the integer or floating-point key of an
+ *      item.
+ * @return      Indices of the items, in sorted order (of type `Index`).
+ */
+template <typename Index = std::size_t, typename RandomIt,
+          typename Projection = Identity>
+std::vector<Index> RadixArgSort(
+        RandomIt first, RandomIt last, Projection proj = Projection()) {
+    auto keys = detail::ProjectedKeys(first, last, proj);
+    std::vector<Index> indices(keys.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    RadixSortByKey(keys.begin(), keys.end(), indices.begin());
+    return indices;
+}
+
+/** Items gathered per block by `ApplyPermutation`.
+ *
+ * While one block is copied, the items of the next are prefetched, so a
+ * block's worth of cache misses are in flight at once instead of one.
+ */
+const int kPermutationGatherBlockSize = 32;
+
+/** Copy the items into the output in the order given by a permutation.
+ *
+ * `output[i] = items[permutation[i]]`, e.g. to put a range into the order
+ * found by `ArgSort`. The reads are random, so they are issued a block at a
+ * time: the items of the next block are prefetched before the current one is
+ * copied.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param perm_first    Iterator to the first index of the permutation.
+ * @param perm_last     Iterator after the last index of the permutation.
+ * @param items         Iterator to the first item to be permuted.
+ * @param output        Iterator to the start of the output range, which must
+ *      not overlap the items.
+ * @return              Iterator after the last item written.
+ */
+template <typename IndexIt, typename RandomIt, typename OutputIt>
+OutputIt ApplyPermutation(
+        IndexIt perm_first, IndexIt perm_last, RandomIt items,
+        OutputIt output) {
+    auto size = perm_last - perm_first;
+    for (decltype(size) begin = 0; begin < size;
+         begin += kPermutationGatherBlockSize) {
+        auto end = std::min(begin + kPermutationGatherBlockSize, size);
+#if defined(__GNUC__)
+        auto next_end = std::min(end + kPermutationGatherBlockSize, size);
+        for (auto index = end; index < next_end; ++index)
+            __builtin_prefetch(&*(items + perm_first[index]));
+#endif
+        for (auto index = begin; index < end; ++index) {
+            *output = items[perm_first[index]];
+            ++output;
+        }
+        COUNT_MOVES(end - begin);
+    }
+    return output;
+}
+
+#endif //ALGORITHMS_STUDY_CPP_SORT_BY_KEY_HPP
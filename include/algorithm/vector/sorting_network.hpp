@@ -0,0 +1,33 @@
+/** Sorting networks for short arrays of ints.
+ *
+ * A sorting network is a fixed sequence of compare-exchanges, independent of
+ * the data, so it has no branches to mispredict and many of its steps can run
+ * side by side in SIMD registers. That makes it much faster than insertion
+ * sort on the short ranges that the recursive sorts bottom out at; the
+ * generic sorts use it for those automatically when sorting ints in ascending
+ * order.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_SORTING_NETWORK_HPP
+#define ALGORITHMS_STUDY_CPP_SORTING_NETWORK_HPP
+
+
+/** Longest array `SortingNetworkSort` can sort.
+ */
+const int kSortingNetworkMaxSize = 64;
+
+/** Sort a short array of ints (in-place) in ascending order with a bitonic
+ * sorting network.
+ *
+ * There are networks for 8, 16, 32 and 64 ints; other sizes are padded up to
+ * the next of those. The network is run with the instructions picked by
+ * `ActiveSimdLevel()`: AVX2, SSE4.1 or plain scalar code.
+ *
+ * Worst-case performance: Theta(n lg^2 n) compare-exchanges, n <= 64
+ *
+ * @param data  Pointer to the first int to be sorted.
+ * @param size  Number of ints, at most `kSortingNetworkMaxSize`.
+ */
+void SortingNetworkSort(int *data, const int size);
+
+#endif //ALGORITHMS_STUDY_CPP_SORTING_NETWORK_HPP
@@ -0,0 +1,136 @@
+/** Static search indexes: a sorted vector of ints laid out again so that
+ * lower bound searches take fewer cache misses than a binary search.
+ *
+ * A binary search of a sorted array touches a new cache line at nearly
+ * every level once the array is bigger than the cache, and its first levels
+ * are scattered over the whole array. These layouts keep the items a search
+ * reads together: the Eytzinger layout stores the implicit binary search
+ * tree level by level, so the next four levels of a search are in one cache
+ * line that can be prefetched, and the static B+ tree ("S+ tree") puts 16
+ * keys in each node, one cache line compared in a couple of SIMD
+ * instructions, so a search takes about log_17 n misses instead of lg n.
+ *
+ * Both are built once from a sorted vector, and answer `LowerBound` queries
+ * with the same contract as the binary search functions: the index in the
+ * sorted vector of the first item not less than the value.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_STATIC_SEARCH_HPP
+#define ALGORITHMS_STUDY_CPP_STATIC_SEARCH_HPP
+
+#include <cstddef>
+#include <vector>
+
+
+/** Keys per node of `StaticBPlusTreeIndex` (a 64-byte cache line of ints). */
+const int kStaticBTreeNodeKeys = 16;
+
+/** A sorted vector of ints in Eytzinger (breadth-first) order.
+ *
+ * Item k of the layout (counting from 1) has its children at 2k and 2k + 1,
+ * as in a binary heap. A search walks down from the root without branching
+ * on the comparisons, prefetching the line 4 levels down as it goes; the
+ * lower bound is then read off the path taken. The tree is padded with the
+ * largest int to a perfect one, so the item's index in the sorted vector
+ * follows from its position, and need not be stored.
+ *
+ * Space: less than two ints per item.
+ */
+class EytzingerIndex {
+public:
+    /** Lay out a sorted vector.
+     *
+     * Worst-case performance: Theta(n)
+     *
+     * @param sorted    Vector in ascending order.
+     */
+    explicit EytzingerIndex(const std::vector<int> &sorted);
+
+    // Copies would lose the keys' alignment; moves keep the same buffer
+    EytzingerIndex(const EytzingerIndex &) = delete;
+    EytzingerIndex &operator=(const EytzingerIndex &) = delete;
+    EytzingerIndex(EytzingerIndex &&) = default;
+    EytzingerIndex &operator=(EytzingerIndex &&) = default;
+
+    /** Return the index of the first item not less than the value.
+     *
+     * Worst-case performance: Theta(lg n)
+     *
+     * @param value     Value to be searched for.
+     * @return          Index into the sorted vector; `size()` if every item
+     *          is less than the value.
+     */
+    std::size_t LowerBound(const int value) const;
+
+    /** Number of items indexed. */
+    std::size_t size() const { return size_; }
+
+private:
+    std::size_t size_;
+    // Number of levels of the padded tree, and of items in it
+    int height_;
+    std::size_t padded_size_;
+    // The keys (from index 1) start at `storage_[offset_]`, which is aligned
+    // to a cache line
+    std::vector<int> storage_;
+    std::size_t offset_;
+
+    const int *keys() const { return storage_.data() + offset_; }
+};
+
+/** A sorted vector of ints as a static B+ tree ("S+ tree") of 16-key nodes.
+ *
+ * The leaves are the sorted vector itself, padded with the largest int to
+ * whole nodes, so the position a search ends at in them is the index
+ * wanted. Above them are layers of internal nodes, each with 17 children;
+ * node k of a layer has children 17 k to 17 k + 16 in the layer below, so
+ * no pointers are stored, and key j of a node is the smallest key under
+ * child j + 1. Each node is one aligned cache line, and the number of its
+ * keys less than the value (which is also the child to go down to) is
+ * counted with SIMD compares: AVX-512, AVX2 or plain C++, as picked by
+ * `ActiveSimdLevel()`.
+ *
+ * Space: about 1 + 1/16 ints per item.
+ */
+class StaticBPlusTreeIndex {
+public:
+    /** Lay out a sorted vector.
+     *
+     * Worst-case performance: Theta(n)
+     *
+     * @param sorted    Vector in ascending order.
+     */
+    explicit StaticBPlusTreeIndex(const std::vector<int> &sorted);
+
+    // Copies would lose the keys' alignment; moves keep the same buffer
+    StaticBPlusTreeIndex(const StaticBPlusTreeIndex &) = delete;
+    StaticBPlusTreeIndex &operator=(const StaticBPlusTreeIndex &) = delete;
+    StaticBPlusTreeIndex(StaticBPlusTreeIndex &&) = default;
+    StaticBPlusTreeIndex &operator=(StaticBPlusTreeIndex &&) = default;
+
+    /** Return the index of the first item not less than the value.
+     *
+     * Worst-case performance: Theta(log_17 n) nodes
+     *
+     * @param value     Value to be searched for.
+     * @return          Index into the sorted vector; `size()` if every item
+     *          is less than the value.
+     */
+    std::size_t LowerBound(const int value) const;
+
+    /** Number of items indexed. */
+    std::size_t size() const { return size_; }
+
+private:
+    std::size_t size_;
+    // Offset of each layer's first node in the node array, leaves first
+    std::vector<std::size_t> layer_offsets_;
+    // The nodes' keys start at `storage_[offset_]`, which is aligned to a
+    // cache line
+    std::vector<int> storage_;
+    std::size_t offset_;
+
+    const int *keys() const { return storage_.data() + offset_; }
+};
+
+#endif //ALGORITHMS_STUDY_CPP_STATIC_SEARCH_HPP
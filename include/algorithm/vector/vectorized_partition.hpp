@@ -0,0 +1,34 @@
+/** SIMD partitioning of int arrays around a pivot value.
+ *
+ * Quicksort partitioning compares every item with the same pivot, so it can
+ * compare a whole register of items at a time; the items of the register
+ * that go left are then packed together and stored at the left end of the
+ * unpartitioned space, and the others at the right end. The generic
+ * `QuicksortPartition` uses this for ints in ascending order when given
+ * `PartitionScheme::kVectorized`.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_VECTORIZED_PARTITION_HPP
+#define ALGORITHMS_STUDY_CPP_VECTORIZED_PARTITION_HPP
+
+
+/** Partition an int array (in-place) around a pivot value.
+ *
+ * Uses AVX-512 (16 ints per step) or AVX2 (8 ints per step), as picked by
+ * `ActiveSimdLevel()`. Without either, and for arrays shorter than two
+ * registers, falls back to the scalar block partition (see
+ * `PartitionScheme::kBlock`). The items are not kept in order.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first             Pointer to the first int to be partitioned.
+ * @param last              Pointer after the last int to be partitioned.
+ * @param pivot             Value to partition around.
+ * @param equality_check    If true, ints equal to the pivot go on the left.
+ *      Otherwise, they go on the right.
+ * @return                  Pointer to the first int of the right partition.
+ */
+int *VectorizedPartition(
+        int *first, int *last, const int pivot, const bool equality_check);
+
+#endif //ALGORITHMS_STUDY_CPP_VECTORIZED_PARTITION_HPP
@@ -0,0 +1,86 @@
+/** SIMD linear scans of int arrays: find a value, find the minimum or
+ * maximum with its position, or gather several statistics in one pass.
+ *
+ * A linear scan does one comparison per item and nothing else, so it can
+ * compare a whole register of items at a time: 8 ints per instruction with
+ * AVX2, 16 with AVX-512. The search, `MinIndex`, `MaxIndex` and
+ * `MinMaxIndex` functions of `search.hpp` are built on these.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_VECTORIZED_SCAN_HPP
+#define ALGORITHMS_STUDY_CPP_VECTORIZED_SCAN_HPP
+
+#include <cstddef>
+
+
+/** Return the first int of an array equal to a value.
+ *
+ * Uses AVX-512 or AVX2, as picked by `ActiveSimdLevel()`, or a plain loop
+ * without either.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Pointer to the first int to be searched.
+ * @param last  Pointer after the last int to be searched.
+ * @param value Value to be searched for.
+ * @return      Pointer to the first int equal to `value`; `last` if none is.
+ */
+const int *VectorizedFind(
+        const int *first, const int *last, const int value);
+
+/** Return the first smallest int of an array.
+ *
+ * Each lane of the registers keeps the smallest int it has seen and its
+ * position, and the lanes are reduced to one at the end. Uses AVX-512 or
+ * AVX2, as picked by `ActiveSimdLevel()`, or a plain loop without either.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Pointer to the first int to be searched.
+ * @param last  Pointer after the last int to be searched.
+ * @return      Pointer to the first of the smallest ints; `last` if the
+ *      array is empty.
+ */
+const int *VectorizedMinElement(const int *first, const int *last);
+
+/** Return the first largest int of an array.
+ *
+ * The counterpart of `VectorizedMinElement`.
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Pointer to the first int to be searched.
+ * @param last  Pointer after the last int to be searched.
+ * @return      Pointer to the first of the largest ints; `last` if the
+ *      array is empty.
+ */
+const int *VectorizedMaxElement(const int *first, const int *last);
+
+/** Statistics of an int array, as gathered by `VectorizedStatistics`.
+ */
+struct ScanStatistics {
+    int min;                ///< Smallest int (the largest int if none).
+    int max;                ///< Largest int (the smallest int if none).
+    std::size_t min_index;  ///< Index of the first smallest int (or 0).
+    std::size_t max_index;  ///< Index of the first largest int (or 0).
+    long long sum;          ///< Sum of the ints.
+    std::size_t count;      ///< Number of ints.
+};
+
+/** Return the minimum, the maximum, their indices, the sum and the count of
+ * an int array, from one pass over it.
+ *
+ * Each lane of the registers keeps its smallest and largest ints and their
+ * positions, and adds its ints to a 64-bit sum. Without AVX2 or AVX-512, a
+ * plain loop takes the ints in pairs, comparing only the smaller of each
+ * with the minimum and the larger with the maximum (1.5 compares per int).
+ *
+ * Worst-case performance: Theta(n)
+ *
+ * @param first Pointer to the first int to be scanned.
+ * @param last  Pointer after the last int to be scanned.
+ * @return      The statistics of `[first, last)`.
+ */
+ScanStatistics VectorizedStatistics(const int *first, const int *last);
+
+#endif //ALGORITHMS_STUDY_CPP_VECTORIZED_SCAN_HPP
@@ -0,0 +1,442 @@
+#include "benchmark/benchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+#include "algorithm/counters.hpp"
+#include "algorithm/random.hpp"
+
+#ifndef BENCHMARK_GIT_COMMIT
+#define BENCHMARK_GIT_COMMIT "unknown"
+#endif
+
+namespace {
+
+std::atomic<unsigned long long> allocation_count(0);
+
+} // namespace
+
+// Replacing the global allocation functions lets the harness count every
+// heap allocation made by the code being benchmarked; the array and sized
+// forms are replaced too, so all of them count the same and free alike.
+void *operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    void *pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+namespace {
+
+/** Free memory from the replaced `operator new`.
+ *
+ * Kept out of line: where `operator delete` is inlined, the compiler would
+ * otherwise see `std::free` called on what `operator new` returned, and warn
+ * of a mismatch (-Wmismatched-new-delete).
+ */
+__attribute__((noinline)) void Deallocate(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+} // namespace
+
+void operator delete(void *pointer) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    Deallocate(pointer);
+}
+
+unsigned long long AllocationCount() {
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+
+std::string DistributionName(const InputDistribution distribution) {
+    switch (distribution) {
+        case InputDistribution::kRandom:    return "random";
+        case InputDistribution::kSorted:    return "sorted";
+        case InputDistribution::kReverse:   return "reverse";
+        case InputDistribution::kFewUnique: return "few_unique";
+        case InputDistribution::kOrganPipe: return "organ_pipe";
+        case InputDistribution::kSawtooth:  return "sawtooth";
+    }
+    throw std::runtime_error("Unknown input distribution!");
+}
+
+std::vector<InputDistribution> AllDistributions() {
+    return {
+        InputDistribution::kRandom, InputDistribution::kSorted,
+        InputDistribution::kReverse, InputDistribution::kFewUnique,
+        InputDistribution::kOrganPipe, InputDistribution::kSawtooth};
+}
+
+std::vector<int> GenerateBenchmarkInput(
+        const int size, const InputDistribution distribution) {
+    std::vector<int> vec(size);
+    if (size == 0)
+        return vec;
+
+    switch (distribution) {
+        case InputDistribution::kRandom:
+            RandomlyFillVector(vec, 0, size - 1);
+            break;
+        case InputDistribution::kSorted:
+            RandomlyFillVector(vec, 0, size - 1);
+            std::sort(vec.begin(), vec.end());
+            break;
+        case InputDistribution::kReverse:
+            RandomlyFillVector(vec, 0, size - 1);
+            std::sort(vec.begin(), vec.end(), std::greater<int>());
+            break;
+        case InputDistribution::kFewUnique:
+            RandomlyFillVector(vec, 0, 15);
+            break;
+        case InputDistribution::kOrganPipe:
+            for (int i = 0; i < size; ++i)
+                vec[i] = std::min(i, size - 1 - i);
+            break;
+        case InputDistribution::kSawtooth: {
+            int tooth = std::max(1, (int)std::sqrt((double)size));
+            for (int i = 0; i < size; ++i)
+                vec[i] = i % tooth;
+            break;
+        }
+    }
+    return vec;
+}
+
+BenchmarkState::BenchmarkState(
+        const int size, const InputDistribution distribution,
+        const int argument, const double min_time)
+    : size_(size), distribution_(distribution), argument_(argument),
+      min_time_(min_time), iterations_(0), elapsed_seconds_(0.),
+      timing_(false), started_(false), allocations_(0),
+      allocations_at_start_(0) {}
+
+bool BenchmarkState::KeepRunning() {
+    if (!started_) {
+        started_ = true;
+        if (skipped())
+            return false;
+        ResumeTiming();
+        return true;
+    }
+
+    // The previous iteration has just finished
+    ++iterations_;
+    double elapsed = elapsed_seconds_;
+    if (timing_)
+        elapsed += std::chrono::duration<double>(
+            Clock::now() - start_time_).count();
+
+    if (skipped() || elapsed >= min_time_ || iterations_ >= 1000000000) {
+        PauseTiming();
+        return false;
+    }
+    return true;
+}
+
+void BenchmarkState::PauseTiming() {
+    if (timing_) {
+        elapsed_seconds_ += std::chrono::duration<double>(
+            Clock::now() - start_time_).count();
+        allocations_ += AllocationCount() - allocations_at_start_;
+        for (auto &counter : perf_counters_)
+            counter->Stop();
+        timing_ = false;
+    }
+}
+
+void BenchmarkState::ResumeTiming() {
+    if (!timing_) {
+        allocations_at_start_ = AllocationCount();
+        for (auto &counter : perf_counters_)
+            counter->Start();
+        start_time_ = Clock::now();
+        timing_ = true;
+    }
+}
+
+void BenchmarkState::SetCounter(const std::string &name, const double value) {
+    counters_[name] = value;
+}
+
+void BenchmarkState::SkipWithMessage(const std::string &message) {
+    skip_message_ = message;
+}
+
+void BenchmarkState::EnablePerfCounters(const std::vector<PerfEvent> &events) {
+    for (PerfEvent event : events)
+        perf_counters_.emplace_back(new PerfCounter(event));
+}
+
+std::map<std::string, double> BenchmarkState::perf_counts() const {
+    std::map<std::string, double> counts;
+    for (const auto &counter : perf_counters_)
+        if (counter->available())
+            counts[PerfEventName(counter->event())] = (double)counter->Read();
+    return counts;
+}
+
+Benchmark::Benchmark(const std::string &name, BenchmarkFunction function)
+    : name_(name), function_(function),
+      max_size_(std::numeric_limits<int>::max()), min_size_(0),
+      distributions_(AllDistributions()), arguments_(1, 0) {}
+
+Benchmark *Benchmark::MaxSize(const int max_size) {
+    max_size_ = max_size;
+    return this;
+}
+
+Benchmark *Benchmark::MinSize(const int min_size) {
+    min_size_ = min_size;
+    return this;
+}
+
+Benchmark *Benchmark::Distributions(
+        const std::vector<InputDistribution> &distributions) {
+    distributions_ = distributions;
+    return this;
+}
+
+Benchmark *Benchmark::Arguments(const std::vector<int> &arguments) {
+    arguments_ = arguments;
+    return this;
+}
+
+Benchmark *Benchmark::PerfCounters(const std::vector<PerfEvent> &events) {
+    perf_events_ = events;
+    return this;
+}
+
+namespace {
+
+// Function-local so registration from other translation units' static
+// initializers can't run before the registry exists.
+std::vector<Benchmark *> &BenchmarkRegistry() {
+    static std::vector<Benchmark *> registry;
+    return registry;
+}
+
+/** Everything measured for one (benchmark, distribution, size, argument).
+ */
+struct BenchmarkResult {
+    std::string name;
+    std::string benchmark;
+    std::string distribution;
+    int size;
+    int argument;
+    long long iterations;
+    double seconds_per_iteration;
+    double allocations_per_iteration;
+    bool skipped;
+    std::string skip_message;
+    OperationCounts counts;
+    std::map<std::string, double> counters;
+};
+
+std::string JsonEscape(const std::string &text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+std::string JsonNumber(const double value) {
+    std::ostringstream stream;
+    stream << std::setprecision(12) << value;
+    return stream.str();
+}
+
+std::string CurrentDate() {
+    std::time_t now = std::time(nullptr);
+    char buffer[32];
+    std::strftime(
+        buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    return buffer;
+}
+
+BenchmarkResult RunOne(
+        const Benchmark &benchmark, const InputDistribution distribution,
+        const int size, const int argument, const double min_time) {
+    BenchmarkResult result;
+    result.benchmark = benchmark.name();
+    result.distribution = DistributionName(distribution);
+    result.size = size;
+    result.argument = argument;
+    result.name = benchmark.name() + "/" + result.distribution + "/" +
+        std::to_string(size);
+    if (benchmark.arguments().size() > 1 || argument != 0)
+        result.name += "/" + std::to_string(argument);
+
+    BenchmarkState state(size, distribution, argument, min_time);
+    state.EnablePerfCounters(benchmark.perf_events());
+    ResetOperationCounts();
+    benchmark.function()(state);
+    OperationCounts counts = GetOperationCounts();
+
+    result.iterations = state.iterations();
+    result.skipped = state.skipped() || state.iterations() == 0;
+    result.skip_message = state.skipped() ?
+        state.skip_message() : "benchmark never called KeepRunning()";
+    result.seconds_per_iteration = result.iterations > 0 ?
+        state.elapsed_seconds() / result.iterations : 0.;
+    result.allocations_per_iteration = result.iterations > 0 ?
+        (double)state.allocations() / result.iterations : 0.;
+
+    // Report operation counts per iteration, like everything else
+    long long iterations = std::max(result.iterations, 1LL);
+    result.counts.comparisons = counts.comparisons / iterations;
+    result.counts.swaps = counts.swaps / iterations;
+    result.counts.moves = counts.moves / iterations;
+    result.counters = state.counters();
+    auto perf_counts = state.perf_counts();
+    for (const auto &count : perf_counts)
+        result.counters[count.first] = count.second / iterations;
+
+    static bool warned_about_perf_counters = false;
+    if (perf_counts.size() < benchmark.perf_events().size() &&
+            !warned_about_perf_counters) {
+        std::cerr << "Hardware performance counters are unavailable here "
+                  << "(check /proc/sys/kernel/perf_event_paranoid); "
+                  << "leaving them out." << std::endl;
+        warned_about_perf_counters = true;
+    }
+    return result;
+}
+
+void PrintResult(const BenchmarkResult &result) {
+    std::cout << std::left << std::setw(48) << result.name << std::right;
+    if (result.skipped) {
+        std::cout << "  skipped: " << result.skip_message << std::endl;
+        return;
+    }
+    double ns_per_element =
+        result.seconds_per_iteration * 1e9 / std::max(result.size, 1);
+    std::cout << std::fixed << std::setprecision(2)
+              << std::setw(14) << result.seconds_per_iteration * 1e9 << " ns"
+              << std::setw(10) << ns_per_element << " ns/item"
+              << std::setw(12) << result.iterations << " iters"
+              << std::setw(12) << result.allocations_per_iteration
+              << " allocs";
+    if (OperationCountingEnabled())
+        std::cout << std::setw(14) << result.counts.comparisons << " cmp"
+                  << std::setw(14) << result.counts.swaps << " swp";
+    for (const auto &counter : result.counters)
+        std::cout << "  " << counter.first << "=" << counter.second;
+    std::cout << std::defaultfloat << std::endl;
+}
+
+void WriteJson(
+        const std::string &path, const std::vector<BenchmarkResult> &results) {
+    std::ofstream out(path);
+    if (!out)
+        throw std::runtime_error("Cannot open benchmark output file " + path);
+
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << CurrentDate() << "\",\n"
+        << "    \"commit\": \"" << JsonEscape(BENCHMARK_GIT_COMMIT) << "\",\n"
+        << "    \"operation_counting\": "
+        << (OperationCountingEnabled() ? "true" : "false") << "\n"
+        << "  },\n  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult &result = results[i];
+        double seconds = result.seconds_per_iteration;
+        out << (i == 0 ? "\n" : ",\n") << "    {"
+            << "\"name\": \"" << JsonEscape(result.name) << "\", "
+            << "\"benchmark\": \"" << JsonEscape(result.benchmark) << "\", "
+            << "\"distribution\": \"" << result.distribution << "\", "
+            << "\"size\": " << result.size << ", "
+            << "\"argument\": " << result.argument << ", ";
+        if (result.skipped) {
+            out << "\"skipped\": \"" << JsonEscape(result.skip_message)
+                << "\"}";
+            continue;
+        }
+        out << "\"iterations\": " << result.iterations << ", "
+            << "\"real_time_ns\": " << JsonNumber(seconds * 1e9) << ", "
+            << "\"ns_per_element\": "
+            << JsonNumber(seconds * 1e9 / std::max(result.size, 1)) << ", "
+            << "\"items_per_second\": "
+            << JsonNumber(seconds > 0 ? result.size / seconds : 0.) << ", "
+            << "\"allocations\": "
+            << JsonNumber(result.allocations_per_iteration);
+        if (OperationCountingEnabled())
+            out << ", \"comparisons\": " << result.counts.comparisons
+                << ", \"swaps\": " << result.counts.swaps
+                << ", \"moves\": " << result.counts.moves;
+        for (const auto &counter : result.counters)
+            out << ", \"" << JsonEscape(counter.first) << "\": "
+                << JsonNumber(counter.second);
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+Benchmark *RegisterBenchmark(
+        const std::string &name, BenchmarkFunction function) {
+    BenchmarkRegistry().push_back(new Benchmark(name, function));
+    return BenchmarkRegistry().back();
+}
+
+int RunBenchmarks(const BenchmarkOptions &options) {
+    std::regex filter(options.filter.empty() ? ".*" : options.filter);
+    std::vector<BenchmarkResult> results;
+
+    std::srand((unsigned int)std::time(nullptr)); // Seed the RNG
+
+    for (const Benchmark *benchmark : BenchmarkRegistry()) {
+        if (!std::regex_search(benchmark->name(), filter))
+            continue;
+
+        for (InputDistribution distribution : benchmark->distributions())
+            for (long long size = 1; size <= options.max_size; size *= 10) {
+                if (size < options.min_size || size < benchmark->min_size() ||
+                        size > benchmark->max_size())
+                    continue;
+                for (int argument : benchmark->arguments()) {
+                    results.push_back(RunOne(
+                        *benchmark, distribution, (int)size, argument,
+                        options.min_time));
+                    PrintResult(results.back());
+                }
+            }
+    }
+
+    if (!options.output_file.empty())
+        WriteJson(options.output_file, results);
+    return 0;
+}
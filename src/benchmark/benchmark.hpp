@@ -0,0 +1,218 @@
+/** A small Google-Benchmark-style harness for timing the algorithms.
+ *
+ * Benchmarks are plain functions taking a `BenchmarkState`, registered with
+ * the `BENCHMARK` macro. Each one is run for every input size (powers of ten)
+ * and input distribution it accepts, and the results are printed as a table
+ * and optionally written to a JSON file so they can be tracked per commit.
+ *
+ * Besides time, the harness reports the number of heap allocations made while
+ * the clock is running (the benchmark executable replaces `operator new` to
+ * count them), comparison/swap counts in operation-counting builds, and
+ * hardware events such as branch misses for benchmarks that ask for them.
+ *
+ *     void BM_Something(BenchmarkState &state) {
+ *         auto input = GenerateBenchmarkInput(
+ *             state.size(), state.distribution());
+ *         while (state.KeepRunning()) {
+ *             state.PauseTiming();
+ *             auto vec = input;       // untimed setup
+ *             state.ResumeTiming();
+ *             Something(vec);
+ *         }
+ *     }
+ *     BENCHMARK(BM_Something)->MaxSize(100000);
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_BENCHMARK_HPP
+#define ALGORITHMS_STUDY_CPP_BENCHMARK_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/perf_counter.hpp"
+
+
+/** Shapes of input data the benchmarks are run against.
+ */
+enum class InputDistribution {
+    kRandom,    ///< Uniformly random values in [0, size).
+    kSorted,    ///< Random values in ascending order.
+    kReverse,   ///< Random values in descending order.
+    kFewUnique, ///< Uniformly random values drawn from only 16 distinct values.
+    kOrganPipe, ///< Ascending to the middle, then descending.
+    kSawtooth   ///< Ascending runs of length sqrt(size), repeated.
+};
+
+/** Return the name used for a distribution in reports.
+ */
+std::string DistributionName(const InputDistribution distribution);
+
+/** Return all the input distributions, in reporting order.
+ */
+std::vector<InputDistribution> AllDistributions();
+
+/** Build a benchmark input with the desired size and distribution.
+ *
+ * Random values come from the generators in `random.hpp`.
+ *
+ * @param size          Number of items in the input.
+ * @param distribution  Shape of the input.
+ * @return              The input vector.
+ */
+std::vector<int> GenerateBenchmarkInput(
+        const int size, const InputDistribution distribution);
+
+/** Per-run state handed to a benchmark function.
+ *
+ * The benchmark calls `KeepRunning()` in a loop, and the harness keeps
+ * answering true until enough time has been measured for a stable result.
+ */
+class BenchmarkState {
+public:
+    BenchmarkState(
+            const int size, const InputDistribution distribution,
+            const int argument, const double min_time);
+
+    /** Number of items the benchmark should work on. */
+    int size() const { return size_; }
+
+    /** Shape of the input the benchmark should work on. */
+    InputDistribution distribution() const { return distribution_; }
+
+    /** Extra benchmark-specific parameter (e.g. a thread count), or 0. */
+    int argument() const { return argument_; }
+
+    /** Start the next iteration; return false once measuring is finished. */
+    bool KeepRunning();
+
+    /** Stop the clock, e.g. while copying the input for the next iteration. */
+    void PauseTiming();
+
+    /** Restart the clock after `PauseTiming()`. */
+    void ResumeTiming();
+
+    /** Report an extra per-iteration counter (averaged over iterations). */
+    void SetCounter(const std::string &name, const double value);
+
+    /** Skip this run, reporting why instead of timing it. */
+    void SkipWithMessage(const std::string &message);
+
+    /** Count these hardware events while the clock is running. */
+    void EnablePerfCounters(const std::vector<PerfEvent> &events);
+
+    /** Total count of each hardware event the system let us measure. */
+    std::map<std::string, double> perf_counts() const;
+
+    long long iterations() const { return iterations_; }
+    unsigned long long allocations() const { return allocations_; }
+    double elapsed_seconds() const { return elapsed_seconds_; }
+    bool skipped() const { return !skip_message_.empty(); }
+    const std::string &skip_message() const { return skip_message_; }
+    const std::map<std::string, double> &counters() const { return counters_; }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    int size_;
+    InputDistribution distribution_;
+    int argument_;
+    double min_time_;
+
+    long long iterations_;
+    double elapsed_seconds_;
+    bool timing_;
+    bool started_;
+    Clock::time_point start_time_;
+    unsigned long long allocations_;
+    unsigned long long allocations_at_start_;
+    std::string skip_message_;
+    std::map<std::string, double> counters_;
+    std::vector<std::unique_ptr<PerfCounter>> perf_counters_;
+};
+
+typedef void (*BenchmarkFunction)(BenchmarkState &state);
+
+/** A registered benchmark, configured by chaining its setters.
+ */
+class Benchmark {
+public:
+    Benchmark(const std::string &name, BenchmarkFunction function);
+
+    /** Don't run this benchmark on inputs larger than this. */
+    Benchmark *MaxSize(const int max_size);
+
+    /** Don't run this benchmark on inputs smaller than this. */
+    Benchmark *MinSize(const int min_size);
+
+    /** Only run this benchmark on these distributions (default: all). */
+    Benchmark *Distributions(
+            const std::vector<InputDistribution> &distributions);
+
+    /** Run this benchmark once for each of these arguments (default: 0). */
+    Benchmark *Arguments(const std::vector<int> &arguments);
+
+    /** Also report these hardware events per iteration, where available. */
+    Benchmark *PerfCounters(const std::vector<PerfEvent> &events);
+
+    const std::string &name() const { return name_; }
+    BenchmarkFunction function() const { return function_; }
+    int max_size() const { return max_size_; }
+    int min_size() const { return min_size_; }
+    const std::vector<InputDistribution> &distributions() const {
+        return distributions_;
+    }
+    const std::vector<int> &arguments() const { return arguments_; }
+    const std::vector<PerfEvent> &perf_events() const { return perf_events_; }
+
+private:
+    std::string name_;
+    BenchmarkFunction function_;
+    int max_size_;
+    int min_size_;
+    std::vector<InputDistribution> distributions_;
+    std::vector<int> arguments_;
+    std::vector<PerfEvent> perf_events_;
+};
+
+/** Add a benchmark to the global registry.
+ *
+ * @param name      Name used in reports and for filtering.
+ * @param function  Function to be benchmarked.
+ * @return          The registered benchmark, for further configuration.
+ */
+Benchmark *RegisterBenchmark(
+        const std::string &name, BenchmarkFunction function);
+
+/** Settings for a whole benchmark run, normally taken from the command line.
+ */
+struct BenchmarkOptions {
+    std::string filter;         ///< Regex the benchmark names must match.
+    std::string output_file;    ///< JSON output path; empty for none.
+    int min_size;               ///< Smallest input size to run.
+    int max_size;               ///< Largest input size to run.
+    double min_time;            ///< Seconds to measure each run for.
+};
+
+/** Return the number of heap allocations made so far by the whole program.
+ */
+unsigned long long AllocationCount();
+
+/** Run every registered benchmark selected by the options.
+ *
+ * @param options   Settings for the run.
+ * @return          Process exit code.
+ */
+int RunBenchmarks(const BenchmarkOptions &options);
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+
+/** Register a benchmark function; chain setters onto the result. */
+#define BENCHMARK(function) \
+    static Benchmark *BENCHMARK_CONCAT(benchmark_registration_, __LINE__) = \
+        RegisterBenchmark(#function, function)
+
+#endif //ALGORITHMS_STUDY_CPP_BENCHMARK_HPP
@@ -0,0 +1,59 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "benchmark/benchmark.hpp"
+
+
+namespace {
+
+/** If the argument is a `--name=value` flag, store its value; return whether.
+ */
+bool ParseFlag(
+        const std::string &argument, const std::string &name,
+        std::string &value) {
+    std::string prefix = "--" + name + "=";
+    if (argument.compare(0, prefix.size(), prefix) != 0)
+        return false;
+    value = argument.substr(prefix.size());
+    return true;
+}
+
+void PrintUsage() {
+    std::cout
+        << "usage: run_benchmarks [options]\n"
+        << "  --benchmark_filter=<regex>    only run matching benchmarks\n"
+        << "  --benchmark_out=<file.json>   write results as JSON\n"
+        << "  --benchmark_min_size=<n>      smallest input size (100)\n"
+        << "  --benchmark_max_size=<n>      largest input size (100000000)\n"
+        << "  --benchmark_min_time=<s>      seconds to time each run (0.5)\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    BenchmarkOptions options;
+    options.min_size = 100;
+    options.max_size = 100000000;
+    options.min_time = 0.5;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        std::string value;
+        if (ParseFlag(argument, "benchmark_filter", value))
+            options.filter = value;
+        else if (ParseFlag(argument, "benchmark_out", value))
+            options.output_file = value;
+        else if (ParseFlag(argument, "benchmark_min_size", value))
+            options.min_size = std::atoi(value.c_str());
+        else if (ParseFlag(argument, "benchmark_max_size", value))
+            options.max_size = std::atoi(value.c_str());
+        else if (ParseFlag(argument, "benchmark_min_time", value))
+            options.min_time = std::atof(value.c_str());
+        else {
+            PrintUsage();
+            return argument == "--help" ? 0 : 1;
+        }
+    }
+    return RunBenchmarks(options);
+}
@@ -0,0 +1,81 @@
+#include "benchmark/perf_counter.hpp"
+
+#include <stdexcept>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+std::string PerfEventName(const PerfEvent event) {
+    switch (event) {
+        case PerfEvent::kBranches:      return "branches";
+        case PerfEvent::kBranchMisses:  return "branch_misses";
+    }
+    throw std::runtime_error("Unknown performance counter event!");
+}
+
+#ifdef __linux__
+
+PerfCounter::PerfCounter(const PerfEvent event)
+    : event_(event), file_descriptor_(-1) {
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.config = event == PerfEvent::kBranches ?
+        PERF_COUNT_HW_BRANCH_INSTRUCTIONS : PERF_COUNT_HW_BRANCH_MISSES;
+    attributes.disabled = 1;
+    attributes.inherit = 1;         // Include threads started by the benchmark
+    attributes.exclude_kernel = 1;  // Allowed with perf_event_paranoid <= 2
+    attributes.exclude_hv = 1;
+
+    // There's no glibc wrapper for this system call; a failure leaves the
+    // counter unavailable
+    file_descriptor_ = (int)syscall(
+        __NR_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+PerfCounter::~PerfCounter() {
+    if (available())
+        close(file_descriptor_);
+}
+
+void PerfCounter::Start() {
+    if (available())
+        ioctl(file_descriptor_, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+void PerfCounter::Stop() {
+    if (available())
+        ioctl(file_descriptor_, PERF_EVENT_IOC_DISABLE, 0);
+}
+
+long long PerfCounter::Read() const {
+    long long count = 0;
+    if (!available() ||
+            read(file_descriptor_, &count, sizeof(count)) != sizeof(count))
+        return 0;
+    return count;
+}
+
+#else
+
+PerfCounter::PerfCounter(const PerfEvent event)
+    : event_(event), file_descriptor_(-1) {}
+
+PerfCounter::~PerfCounter() {}
+
+void PerfCounter::Start() {}
+
+void PerfCounter::Stop() {}
+
+long long PerfCounter::Read() const {
+    return 0;
+}
+
+#endif
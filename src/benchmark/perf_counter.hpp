@@ -0,0 +1,58 @@
+/** Hardware performance counters for the benchmark harness.
+ *
+ * On Linux these use `perf_event_open` to count events of the benchmarking
+ * thread (and threads it starts) while the clock is running. Where the
+ * counters are unavailable (other systems, containers without perf access,
+ * `perf_event_paranoid` too strict) they just report `available() == false`,
+ * and the harness leaves them out of the results.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_PERF_COUNTER_HPP
+#define ALGORITHMS_STUDY_CPP_PERF_COUNTER_HPP
+
+#include <string>
+
+
+/** Hardware events a `PerfCounter` can count.
+ */
+enum class PerfEvent {
+    kBranches,      ///< Retired branch instructions.
+    kBranchMisses   ///< Mispredicted branch instructions.
+};
+
+/** Return the name used for a hardware event in reports.
+ */
+std::string PerfEventName(const PerfEvent event);
+
+/** One hardware event counter, started and stopped around timed code.
+ */
+class PerfCounter {
+public:
+    /** Open the counter (stopped, at zero). */
+    explicit PerfCounter(const PerfEvent event);
+    ~PerfCounter();
+
+    PerfCounter(const PerfCounter &) = delete;
+    PerfCounter &operator=(const PerfCounter &) = delete;
+
+    /** The event being counted. */
+    PerfEvent event() const { return event_; }
+
+    /** Whether the system let us open the counter. */
+    bool available() const { return file_descriptor_ >= 0; }
+
+    /** Start counting (no-op if unavailable). */
+    void Start();
+
+    /** Stop counting; later `Start()`s add on (no-op if unavailable). */
+    void Stop();
+
+    /** Total events counted while started, or 0 if unavailable. */
+    long long Read() const;
+
+private:
+    PerfEvent event_;
+    int file_descriptor_;
+};
+
+#endif //ALGORITHMS_STUDY_CPP_PERF_COUNTER_HPP
@@ -0,0 +1,43 @@
+#include "algorithm/counters.hpp"
+
+#include <atomic>
+
+
+#ifdef ALGORITHMS_STUDY_COUNT_OPERATIONS
+
+std::atomic<unsigned long long> comparison_count(0);
+std::atomic<unsigned long long> swap_count(0);
+std::atomic<unsigned long long> move_count(0);
+
+bool OperationCountingEnabled() {
+    return true;
+}
+
+OperationCounts GetOperationCounts() {
+    OperationCounts counts;
+    counts.comparisons = comparison_count.load();
+    counts.swaps = swap_count.load();
+    counts.moves = move_count.load();
+    return counts;
+}
+
+void ResetOperationCounts() {
+    comparison_count = 0;
+    swap_count = 0;
+    move_count = 0;
+}
+
+#else
+
+bool OperationCountingEnabled() {
+    return false;
+}
+
+OperationCounts GetOperationCounts() {
+    OperationCounts counts = {0, 0, 0};
+    return counts;
+}
+
+void ResetOperationCounts() {}
+
+#endif
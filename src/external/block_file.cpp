@@ -0,0 +1,184 @@
+#include "block_file.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace detail {
+
+namespace {
+
+std::runtime_error IoError(const std::string &what, const std::string &path) {
+    return std::runtime_error(
+        what + " " + path + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+AlignedBuffer::AlignedBuffer(const std::size_t bytes)
+    : data_(nullptr), size_(bytes) {
+    void *memory = nullptr;
+    if (posix_memalign(&memory, kDirectIoAlignment, AlignUp(bytes)) != 0)
+        throw std::bad_alloc();
+    data_ = static_cast<char *>(memory);
+}
+
+AlignedBuffer::~AlignedBuffer() {
+    std::free(data_);
+}
+
+BlockFile::BlockFile(
+        const std::string &path, const Mode mode, const bool direct_io)
+    : path_(path), fd_(-1), direct_(false) {
+    int flags = mode == Mode::kRead ?
+        O_RDONLY : O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_DIRECT
+    // Some file systems (e.g. tmpfs) refuse O_DIRECT; use the page cache there
+    if (direct_io) {
+        fd_ = open(path.c_str(), flags | O_DIRECT, 0644);
+        direct_ = fd_ >= 0;
+    }
+#else
+    (void)direct_io;
+#endif
+    if (fd_ < 0)
+        fd_ = open(path.c_str(), flags, 0644);
+    if (fd_ < 0)
+        throw IoError("Can't open", path);
+}
+
+BlockFile::~BlockFile() {
+    close(fd_);
+}
+
+std::uint64_t BlockFile::Size() const {
+    struct stat status;
+    if (fstat(fd_, &status) != 0)
+        throw IoError("Can't stat", path_);
+    return (std::uint64_t)status.st_size;
+}
+
+std::size_t BlockFile::Read(void *buffer, const std::size_t bytes) {
+    char *next = static_cast<char *>(buffer);
+    std::size_t total = 0;
+    while (total < bytes) {
+        ssize_t count = read(fd_, next + total, bytes - total);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count < 0)
+            throw IoError("Can't read", path_);
+        if (count == 0)
+            break;
+        total += count;
+    }
+    return total;
+}
+
+void BlockFile::Write(const void *buffer, const std::size_t bytes) {
+    const char *next = static_cast<const char *>(buffer);
+    std::size_t total = 0;
+    while (total < bytes) {
+        std::size_t chunk = bytes - total;
+#ifdef O_DIRECT
+        // Direct writes must be whole blocks; the tail at the end of the file
+        // goes through the page cache
+        if (direct_ && chunk % kDirectIoAlignment != 0) {
+            chunk -= chunk % kDirectIoAlignment;
+            if (chunk == 0) {
+                if (fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) & ~O_DIRECT) != 0)
+                    throw IoError("Can't reconfigure", path_);
+                direct_ = false;
+                continue;
+            }
+        }
+#endif
+        ssize_t count = write(fd_, next + total, chunk);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count < 0)
+            throw IoError("Can't write", path_);
+        total += count;
+    }
+}
+
+KeyReader::KeyReader(
+        const std::string &path, const std::size_t block_bytes,
+        const bool direct_io)
+    : file_(path, BlockFile::Mode::kRead, direct_io),
+      buffers_{AlignedBuffer(block_bytes), AlignedBuffer(block_bytes)},
+      current_(0), keys_(nullptr), position_(0), end_(0) {
+    StartRead();
+}
+
+KeyReader::~KeyReader() {
+    if (pending_read_.valid())
+        pending_read_.wait();
+}
+
+void KeyReader::StartRead() {
+    AlignedBuffer &buffer = buffers_[current_];
+    pending_read_ = std::async(std::launch::async, [this, &buffer]() {
+        return file_.Read(buffer.data(), buffer.size());
+    });
+}
+
+bool KeyReader::NextBlock() {
+    if (!pending_read_.valid())
+        return false;
+    std::size_t bytes = pending_read_.get();
+    if (bytes == 0)
+        return false;
+    keys_ = reinterpret_cast<const std::int64_t *>(buffers_[current_].data());
+    position_ = 0;
+    end_ = bytes / sizeof(std::int64_t);
+
+    // A short read means the end of the file was reached
+    current_ = 1 - current_;
+    if (bytes == buffers_[0].size())
+        StartRead();
+    return end_ > 0;
+}
+
+KeyWriter::KeyWriter(
+        const std::string &path, const std::size_t block_bytes,
+        const bool direct_io)
+    : file_(path, BlockFile::Mode::kWrite, direct_io),
+      buffers_{AlignedBuffer(block_bytes), AlignedBuffer(block_bytes)},
+      current_(0),
+      keys_(reinterpret_cast<std::int64_t *>(buffers_[0].data())),
+      position_(0), capacity_(block_bytes / sizeof(std::int64_t)) {}
+
+KeyWriter::~KeyWriter() {
+    if (pending_write_.valid())
+        pending_write_.wait();
+}
+
+void KeyWriter::Flush() {
+    // The other buffer has to be written out before it can be refilled
+    if (pending_write_.valid())
+        pending_write_.get();
+    const char *data = buffers_[current_].data();
+    std::size_t bytes = position_ * sizeof(std::int64_t);
+    pending_write_ = std::async(std::launch::async, [this, data, bytes]() {
+        file_.Write(data, bytes);
+    });
+    current_ = 1 - current_;
+    keys_ = reinterpret_cast<std::int64_t *>(buffers_[current_].data());
+    position_ = 0;
+}
+
+void KeyWriter::Close() {
+    if (position_ > 0)
+        Flush();
+    if (pending_write_.valid())
+        pending_write_.get();
+}
+
+} // namespace detail
@@ -0,0 +1,178 @@
+/** Large sequential reads and writes for the external sort (internal).
+ *
+ * Files are read and written in big blocks, optionally with `O_DIRECT` (which
+ * skips the page cache: the data is streamed once, so caching it would only
+ * push more useful pages out). The key streams are double buffered: the next
+ * block is read, or the last one written, on a background thread while the
+ * caller works on the other one.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_BLOCK_FILE_HPP
+#define ALGORITHMS_STUDY_CPP_BLOCK_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+
+
+namespace detail {
+
+/** Alignment of direct I/O buffers, file offsets and transfer sizes.
+ */
+const std::size_t kDirectIoAlignment = 4096;
+
+/** Round `bytes` up to a multiple of `kDirectIoAlignment`. */
+inline std::size_t AlignUp(const std::size_t bytes) {
+    return (bytes + kDirectIoAlignment - 1) / kDirectIoAlignment *
+        kDirectIoAlignment;
+}
+
+/** A heap buffer aligned for direct I/O.
+ */
+class AlignedBuffer {
+public:
+    /** Allocate `bytes` bytes (throws `std::bad_alloc` on failure). */
+    explicit AlignedBuffer(const std::size_t bytes);
+    ~AlignedBuffer();
+
+    AlignedBuffer(AlignedBuffer &&other)
+        : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    AlignedBuffer(const AlignedBuffer &) = delete;
+    AlignedBuffer &operator=(const AlignedBuffer &) = delete;
+
+    char *data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    char *data_;
+    std::size_t size_;
+};
+
+/** A file that is either read or written from start to end.
+ *
+ * All errors are thrown as `std::runtime_error`, naming the file.
+ */
+class BlockFile {
+public:
+    enum class Mode { kRead, kWrite };
+
+    /** Open the file (a file opened for writing is created or truncated).
+     *
+     * @param path      Path of the file.
+     * @param mode      Whether the file is read or written.
+     * @param direct_io Try to bypass the page cache. Falls back to normal
+     *      I/O where the platform or file system doesn't support it.
+     */
+    BlockFile(const std::string &path, const Mode mode, const bool direct_io);
+    ~BlockFile();
+
+    BlockFile(const BlockFile &) = delete;
+    BlockFile &operator=(const BlockFile &) = delete;
+
+    /** Size of the file, in bytes. */
+    std::uint64_t Size() const;
+
+    /** Read the next `bytes` bytes, or up to the end of the file.
+     *
+     * With direct I/O, `buffer` and `bytes` must be aligned.
+     *
+     * @return  Bytes read; less than `bytes` only at the end of the file.
+     */
+    std::size_t Read(void *buffer, const std::size_t bytes);
+
+    /** Append `bytes` bytes.
+     *
+     * With direct I/O, `buffer` must be aligned; a size that is not aligned
+     * is only allowed for the last write to the file.
+     */
+    void Write(const void *buffer, const std::size_t bytes);
+
+private:
+    std::string path_;
+    int fd_;
+    bool direct_;
+};
+
+/** Reads a file of int64 keys, loading blocks ahead in the background.
+ */
+class KeyReader {
+public:
+    /** @param path         Path of the file.
+     *  @param block_bytes  Bytes per read (a multiple of
+     *      `kDirectIoAlignment`).
+     *  @param direct_io    Try to bypass the page cache.
+     */
+    KeyReader(
+        const std::string &path, const std::size_t block_bytes,
+        const bool direct_io);
+    ~KeyReader();
+
+    /** Read the next key.
+     *
+     * @return  False at the end of the file.
+     */
+    bool Next(std::int64_t &key) {
+        if (position_ == end_ && !NextBlock())
+            return false;
+        key = keys_[position_++];
+        return true;
+    }
+
+private:
+    bool NextBlock();
+    void StartRead();
+
+    BlockFile file_;
+    AlignedBuffer buffers_[2];
+    int current_;
+    std::future<std::size_t> pending_read_;
+    const std::int64_t *keys_;
+    std::size_t position_;
+    std::size_t end_;
+};
+
+/** Writes a file of int64 keys, writing full blocks in the background.
+ */
+class KeyWriter {
+public:
+    /** @param path         Path of the file.
+     *  @param block_bytes  Bytes per write (a multiple of
+     *      `kDirectIoAlignment`).
+     *  @param direct_io    Try to bypass the page cache.
+     */
+    KeyWriter(
+        const std::string &path, const std::size_t block_bytes,
+        const bool direct_io);
+
+    /** Wait for any write still running; call `Close()` to see errors. */
+    ~KeyWriter();
+
+    /** Append a key. */
+    void Write(const std::int64_t key) {
+        if (position_ == capacity_)
+            Flush();
+        keys_[position_++] = key;
+    }
+
+    /** Write out the buffered keys and wait until everything is written. */
+    void Close();
+
+private:
+    void Flush();
+
+    BlockFile file_;
+    AlignedBuffer buffers_[2];
+    int current_;
+    std::future<void> pending_write_;
+    std::int64_t *keys_;
+    std::size_t position_;
+    std::size_t capacity_;
+};
+
+} // namespace detail
+
+#endif //ALGORITHMS_STUDY_CPP_BLOCK_FILE_HPP
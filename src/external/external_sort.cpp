@@ -0,0 +1,186 @@
+#include "algorithm/external/external_sort.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "algorithm/vector/loser_tree.hpp"
+#include "algorithm/vector/radix_sort.hpp"
+#include "block_file.hpp"
+
+using detail::AlignedBuffer;
+using detail::BlockFile;
+using detail::KeyReader;
+using detail::KeyWriter;
+
+
+namespace {
+
+/** Names the temporary run files, and removes any left when destroyed.
+ */
+class TempFiles {
+public:
+    explicit TempFiles(const std::string &prefix)
+        : prefix_(prefix), next_id_(0) {}
+
+    ~TempFiles() {
+        for (const std::string &path : paths_)
+            std::remove(path.c_str());
+    }
+
+    TempFiles(const TempFiles &) = delete;
+    TempFiles &operator=(const TempFiles &) = delete;
+
+    /** Return the path for a new run file. */
+    std::string Add() {
+        std::string path = prefix_ + ".run" + std::to_string(next_id_++);
+        paths_.insert(path);
+        return path;
+    }
+
+    /** Delete a run file that is no longer needed. */
+    void Remove(const std::string &path) {
+        std::remove(path.c_str());
+        paths_.erase(path);
+    }
+
+private:
+    std::string prefix_;
+    int next_id_;
+    std::set<std::string> paths_;
+};
+
+/** Write keys to a new file in one sequential write.
+ */
+void WriteKeys(
+        const std::string &path, const std::int64_t *keys,
+        const std::size_t count, const bool direct_io) {
+    BlockFile file(path, BlockFile::Mode::kWrite, direct_io);
+    file.Write(keys, count * sizeof(std::int64_t));
+}
+
+/** Merge sorted run files into one file, with a loser tree.
+ */
+void MergeRuns(
+        const std::vector<std::string> &runs, const std::string &output_path,
+        const std::size_t block_bytes, const bool direct_io) {
+    int num_runs = (int)runs.size();
+    std::vector<std::unique_ptr<KeyReader>> readers;
+    LoserTree<std::int64_t> tree(num_runs);
+    for (int run = 0; run < num_runs; ++run) {
+        readers.emplace_back(new KeyReader(runs[run], block_bytes, direct_io));
+        std::int64_t key;
+        if (readers[run]->Next(key))
+            tree.SetKey(run, key);
+    }
+    tree.Build();
+
+    KeyWriter writer(output_path, block_bytes, direct_io);
+    while (!tree.Empty()) {
+        writer.Write(tree.WinnerKey());
+        std::int64_t key;
+        if (readers[tree.Winner()]->Next(key))
+            tree.ReplaceWinner(key);
+        else
+            tree.RemoveWinner();
+    }
+    writer.Close();
+}
+
+} // namespace
+
+ExternalSortStats ExternalSort(
+        const std::string &input_path, const std::string &output_path,
+        const ExternalSortOptions &options /*= ExternalSortOptions()*/) {
+    const std::size_t alignment = detail::kDirectIoAlignment;
+    const std::size_t block_bytes = detail::AlignUp(
+        std::max(options.block_bytes, alignment));
+    const std::size_t chunk_bytes = std::max(
+        options.memory_bytes / 2 / alignment * alignment, alignment);
+    // Each run being merged has two blocks, and so does the output
+    std::size_t fan_in = std::max(
+        options.memory_bytes / (2 * block_bytes), (std::size_t)3) - 1;
+    if (options.max_fan_in > 0)
+        fan_in = std::min(fan_in, (std::size_t)std::max(options.max_fan_in, 2));
+
+    ExternalSortStats stats = {0, 0, 0};
+    TempFiles temp_files(
+        options.temp_prefix.empty() ? output_path : options.temp_prefix);
+    std::vector<std::string> runs;
+
+    // Form sorted runs, reading the next chunk while sorting this one
+    {
+        BlockFile input(
+            input_path, BlockFile::Mode::kRead, options.direct_io);
+        std::uint64_t input_bytes = input.Size();
+        if (input_bytes % sizeof(std::int64_t) != 0)
+            throw std::runtime_error(
+                input_path + " does not hold a whole number of int64 keys");
+        stats.num_keys = input_bytes / sizeof(std::int64_t);
+        bool fits_in_memory = input_bytes <= chunk_bytes;
+
+        AlignedBuffer chunks[2] = {
+            AlignedBuffer(chunk_bytes),
+            AlignedBuffer(fits_in_memory ? 0 : chunk_bytes)};
+        auto read_chunk = [&input, &chunks](const int index) {
+            return input.Read(chunks[index].data(), chunks[index].size());
+        };
+        int current = 0;
+        std::future<std::size_t> next_read = std::async(
+            std::launch::async, read_chunk, current);
+        while (true) {
+            std::size_t bytes = next_read.get();
+            bool last_chunk = fits_in_memory || bytes < chunk_bytes;
+            if (!last_chunk)
+                next_read = std::async(
+                    std::launch::async, read_chunk, 1 - current);
+
+            std::int64_t *keys =
+                reinterpret_cast<std::int64_t *>(chunks[current].data());
+            std::size_t num_keys = bytes / sizeof(std::int64_t);
+            AmericanFlagSort(keys, keys + num_keys);
+            if (fits_in_memory) {
+                WriteKeys(output_path, keys, num_keys, options.direct_io);
+                stats.num_runs = num_keys > 0;
+                return stats;
+            }
+            if (num_keys > 0) {
+                runs.push_back(temp_files.Add());
+                WriteKeys(runs.back(), keys, num_keys, options.direct_io);
+            }
+
+            if (last_chunk)
+                break;
+            current = 1 - current;
+        }
+    }
+    stats.num_runs = (int)runs.size();
+
+    // Merge groups of runs into longer runs until one pass can finish
+    while (runs.size() > fan_in) {
+        std::vector<std::string> merged;
+        for (std::size_t begin = 0; begin < runs.size(); begin += fan_in) {
+            std::size_t end = std::min(begin + fan_in, runs.size());
+            if (end - begin == 1) {
+                merged.push_back(runs[begin]);
+                continue;
+            }
+            std::vector<std::string> group(
+                runs.begin() + begin, runs.begin() + end);
+            merged.push_back(temp_files.Add());
+            MergeRuns(group, merged.back(), block_bytes, options.direct_io);
+            for (const std::string &run : group)
+                temp_files.Remove(run);
+        }
+        runs.swap(merged);
+        ++stats.merge_passes;
+    }
+
+    MergeRuns(runs, output_path, block_bytes, options.direct_io);
+    ++stats.merge_passes;
+    return stats;
+}
@@ -0,0 +1,58 @@
+/** Benchmarks for `external_sort.cpp`
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/external/external_sort.hpp"
+
+
+namespace {
+
+/** Memory budgets, as fractions (1 / argument) of the input size.
+ *
+ * 1 sorts in memory; the others force a merge of 2 or 8 runs.
+ */
+const std::vector<int> kMemoryFractions = {1, 2, 8};
+
+/** Time sorting a file of int64 keys with a memory budget smaller than it.
+ *
+ * The file is written to the current directory, so this measures whatever
+ * storage that is on (and its page cache, unless the data outgrows it).
+ */
+void BM_ExternalSort(BenchmarkState &state) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    std::vector<std::int64_t> keys(input.begin(), input.end());
+    std::string input_path = "external_sort_bench.in";
+    std::string output_path = "external_sort_bench.out";
+    {
+        std::ofstream file(input_path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(keys.data()),
+                   keys.size() * sizeof(std::int64_t));
+    }
+
+    ExternalSortOptions options;
+    options.memory_bytes =
+        2 * keys.size() * sizeof(std::int64_t) / state.argument() + 8192;
+    options.block_bytes = 64 << 10;
+    ExternalSortStats stats = {0, 0, 0};
+    while (state.KeepRunning())
+        stats = ExternalSort(input_path, output_path, options);
+    state.SetCounter("runs", stats.num_runs);
+
+    std::remove(input_path.c_str());
+    std::remove(output_path.c_str());
+}
+
+} // namespace
+
+BENCHMARK(BM_ExternalSort)
+    ->MinSize(100000)
+    ->MaxSize(10000000)
+    ->Distributions({InputDistribution::kRandom, InputDistribution::kSorted})
+    ->Arguments(kMemoryFractions);
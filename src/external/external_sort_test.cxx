@@ -0,0 +1,144 @@
+/** Unit tests for `external_sort.cpp`
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/external/external_sort.hpp"
+
+
+/** Test fixture that writes inputs to temporary files and cleans them up.
+ */
+class ExternalSortTest: public ::testing::Test {
+public:
+    std::string input_path;
+    std::string output_path;
+
+protected:
+    virtual void SetUp() {
+        const char *temp_dir = std::getenv("TMPDIR");
+        std::string prefix = std::string(temp_dir ? temp_dir : "/tmp") +
+            "/external_sort_test_" + std::to_string(std::rand());
+        input_path = prefix + ".in";
+        output_path = prefix + ".out";
+    }
+
+    virtual void TearDown() {
+        std::remove(input_path.c_str());
+        std::remove(output_path.c_str());
+    }
+
+    /** Write random keys (including the extremes) to the input file. */
+    std::vector<std::int64_t> WriteRandomInput(const std::size_t num_keys) {
+        std::mt19937_64 rng(num_keys);
+        std::vector<std::int64_t> keys(num_keys);
+        for (std::int64_t &key : keys)
+            key = (std::int64_t)rng();
+        if (num_keys > 2) {
+            keys[0] = std::numeric_limits<std::int64_t>::min();
+            keys[1] = std::numeric_limits<std::int64_t>::max();
+        }
+        WriteFile(input_path, keys);
+        return keys;
+    }
+
+    static void WriteFile(
+            const std::string &path, const std::vector<std::int64_t> &keys) {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(keys.data()),
+                   keys.size() * sizeof(std::int64_t));
+    }
+
+    static std::vector<std::int64_t> ReadFile(const std::string &path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        std::vector<std::int64_t> keys(
+            (std::size_t)file.tellg() / sizeof(std::int64_t));
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(keys.data()),
+                  keys.size() * sizeof(std::int64_t));
+        return keys;
+    }
+
+    /** Options small enough to make a few thousand keys need many runs. */
+    static ExternalSortOptions SmallMemoryOptions() {
+        ExternalSortOptions options;
+        options.memory_bytes = 64 << 10;
+        options.block_bytes = 4 << 10;
+        return options;
+    }
+};
+
+TEST_F(ExternalSortTest, SortsInputThatFitsInMemory) {
+    auto keys = WriteRandomInput(1000);
+    ExternalSortStats stats = ExternalSort(input_path, output_path);
+
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(ReadFile(output_path), keys) << "Output is not sorted input!";
+    EXPECT_EQ(stats.num_keys, 1000u) << "Wrong number of keys reported!";
+    EXPECT_EQ(stats.num_runs, 1) << "Input should have been one run!";
+    EXPECT_EQ(stats.merge_passes, 0) << "Nothing should have been merged!";
+}
+
+TEST_F(ExternalSortTest, SortsEmptyInput) {
+    WriteRandomInput(0);
+    ExternalSort(input_path, output_path, SmallMemoryOptions());
+    EXPECT_TRUE(ReadFile(output_path).empty())
+        << "Sorting an empty file must give an empty file!";
+}
+
+TEST_F(ExternalSortTest, MergesManyRunsInOnePass) {
+    // 4096 keys per run, and room for 7 runs per merge
+    auto keys = WriteRandomInput(6 * 4096 + 123);
+    ExternalSortStats stats = ExternalSort(
+        input_path, output_path, SmallMemoryOptions());
+
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(ReadFile(output_path), keys) << "Output is not sorted input!";
+    EXPECT_EQ(stats.num_runs, 7) << "Input was split into the wrong runs!";
+    EXPECT_EQ(stats.merge_passes, 1) << "Runs should merge in one pass!";
+}
+
+TEST_F(ExternalSortTest, MergesInSeveralPassesWhenFanInIsLimited) {
+    auto keys = WriteRandomInput(20 * 4096);
+    for (int fan_in : {2, 3, 5}) {
+        ExternalSortOptions options = SmallMemoryOptions();
+        options.max_fan_in = fan_in;
+        options.direct_io = fan_in == 3;
+        ExternalSortStats stats = ExternalSort(
+            input_path, output_path, options);
+
+        int expected_passes = 0;
+        for (int runs = 20; runs > 1; runs = (runs + fan_in - 1) / fan_in)
+            ++expected_passes;
+        auto expected_keys(keys);
+        std::sort(expected_keys.begin(), expected_keys.end());
+        EXPECT_EQ(ReadFile(output_path), expected_keys)
+            << "Output is not sorted input with fan-in " << fan_in << "!";
+        EXPECT_EQ(stats.merge_passes, expected_passes)
+            << "Wrong number of passes with fan-in " << fan_in << "!";
+
+        std::ifstream leftover_run(output_path + ".run0");
+        EXPECT_FALSE(leftover_run.good()) << "Run files were not removed!";
+    }
+}
+
+TEST_F(ExternalSortTest, RejectsTruncatedInput) {
+    std::ofstream(input_path, std::ios::binary) << "12345";
+    EXPECT_THROW(ExternalSort(input_path, output_path), std::runtime_error)
+        << "A partial key at the end must be reported!";
+}
+
+TEST_F(ExternalSortTest, ReportsMissingInput) {
+    EXPECT_THROW(ExternalSort(input_path, output_path), std::runtime_error)
+        << "A missing input file must be reported!";
+}
@@ -0,0 +1,151 @@
+#include "algorithm/parallel/thread_pool.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+
+namespace {
+
+// Which pool (if any) the current thread works for, and which queue it owns
+thread_local const ThreadPool *current_pool = nullptr;
+thread_local int current_index = 0;
+
+} // namespace
+
+int ResolveThreadCount(const int num_threads) {
+    if (num_threads > 0)
+        return num_threads;
+    return std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+ThreadPool::ThreadPool(const int num_threads /*= 0*/)
+    : queued_tasks_(0), stopping_(false) {
+    int total_threads = ResolveThreadCount(num_threads);
+    for (int i = 0; i < total_threads; ++i)
+        workers_.emplace_back(new TaskQueue);
+    for (int i = 1; i < total_threads; ++i)
+        threads_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_up_.notify_all();
+    for (auto &thread : threads_)
+        thread.join();
+
+    // With no background workers, queued tasks still have to run somewhere
+    while (RunPendingTask()) {}
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+    int index = current_pool == this ? current_index : 0;
+    {
+        std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+        workers_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        ++queued_tasks_;
+    }
+    wake_up_.notify_one();
+}
+
+bool ThreadPool::RunPendingTask() {
+    std::function<void()> task;
+    if (!PopTask(current_pool == this ? current_index : 0, task))
+        return false;
+    task();
+    return true;
+}
+
+bool ThreadPool::PopTask(const int index, std::function<void()> &task) {
+    // Newest task from our own queue first...
+    {
+        TaskQueue &own = *workers_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            --queued_tasks_;
+            return true;
+        }
+    }
+    // ...otherwise steal the oldest task of someone else
+    int num_queues = (int)workers_.size();
+    for (int offset = 1; offset < num_queues; ++offset) {
+        TaskQueue &victim = *workers_[(index + offset) % num_queues];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --queued_tasks_;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::WorkerLoop(const int index) {
+    current_pool = this;
+    current_index = index;
+
+    std::function<void()> task;
+    while (true) {
+        if (PopTask(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_up_.wait(lock, [this] {
+            return stopping_ || queued_tasks_ > 0;
+        });
+        if (stopping_ && queued_tasks_ == 0)
+            return;
+    }
+}
+
+TaskGroup::TaskGroup(ThreadPool &pool) : pool_(pool), pending_(0) {}
+
+TaskGroup::~TaskGroup() {
+    try {
+        Wait();
+    }
+    catch (...) {
+        // Destructors must not throw; call Wait() to see task exceptions
+    }
+}
+
+void TaskGroup::Run(std::function<void()> task) {
+    ++pending_;
+    pool_.Submit([this, task]() {
+        try {
+            task();
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex_);
+            if (!exception_)
+                exception_ = std::current_exception();
+        }
+        // Nothing may touch the group after this; its owner may be gone
+        --pending_;
+    });
+}
+
+void TaskGroup::Wait() {
+    while (pending_ > 0)
+        if (!pool_.RunPendingTask())
+            std::this_thread::yield();
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(exception_mutex_);
+        std::swap(exception, exception_);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
@@ -0,0 +1,73 @@
+/** Unit tests for `thread_pool.cpp`
+ */
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/parallel/thread_pool.hpp"
+
+
+namespace {
+
+/** Naive fork-join Fibonacci, to exercise nested task groups.
+ */
+long long ParallelFibonacci(ThreadPool &pool, const int n) {
+    if (n < 2)
+        return n;
+    long long left = 0;
+    TaskGroup group(pool);
+    group.Run([&]() { left = ParallelFibonacci(pool, n - 1); });
+    long long right = ParallelFibonacci(pool, n - 2);
+    group.Wait();
+    return left + right;
+}
+
+} // namespace
+
+/** Every task of a group must have run once the group has been waited on.
+ */
+TEST(ThreadPoolTest, TaskGroupRunsAllTasks) {
+    for (int num_threads : {1, 2, 4}) {
+        ThreadPool pool(num_threads);
+        EXPECT_EQ(pool.NumThreads(), num_threads);
+
+        std::atomic<int> counter(0);
+        TaskGroup group(pool);
+        for (int i = 0; i < 1000; ++i)
+            group.Run([&counter]() { ++counter; });
+        group.Wait();
+
+        EXPECT_EQ(counter.load(), 1000)
+            << "Not all tasks ran with " << num_threads << " threads.";
+    }
+}
+
+/** Tasks forking their own tasks must not deadlock, even with one thread.
+ */
+TEST(ThreadPoolTest, NestedTaskGroupsComplete) {
+    for (int num_threads : {1, 3, 8}) {
+        ThreadPool pool(num_threads);
+        EXPECT_EQ(ParallelFibonacci(pool, 20), 6765)
+            << "Wrong result with " << num_threads << " threads.";
+    }
+}
+
+/** An exception thrown by a task is rethrown by the group's `Wait()`.
+ */
+TEST(ThreadPoolTest, WaitRethrowsTaskException) {
+    ThreadPool pool(2);
+    TaskGroup group(pool);
+    group.Run([]() { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(group.Wait(), std::runtime_error);
+}
+
+/** Asking for 0 threads means one per core (and always at least one).
+ */
+TEST(ThreadPoolTest, ZeroThreadsMeansAllCores) {
+    EXPECT_GE(ResolveThreadCount(0), 1);
+    EXPECT_EQ(ResolveThreadCount(3), 3);
+}
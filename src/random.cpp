@@ -68,17 +68,5 @@ void RandomlyPermute(std::vector<int> &vec) {
 };
 
 std::vector<int> RandomlySample(std::vector<int> &vec, int num_samples) {
-    std::vector<int> sample_vec;
-    for (int i = 0; i < num_samples; ++i) {
-        int sample_range = vec.size() - num_samples + i;
-        auto random_int = RandomInteger(0, sample_range);
-        if ( // This just checks if the item is already in the sample
-                std::find(
-                    sample_vec.begin(), sample_vec.end(), vec[random_int]
-                ) != sample_vec.end())
-            sample_vec.push_back(vec[sample_range]);
-        else
-            sample_vec.push_back(vec[random_int]);
-    }
-    return sample_vec;
-};
+    return RandomlySample(vec.begin(), vec.end(), num_samples);
+}
@@ -0,0 +1,62 @@
+#include "algorithm/simd.hpp"
+
+#include <atomic>
+
+
+namespace {
+
+// -1 until the first call to ActiveSimdLevel() or SetSimdLevel()
+std::atomic<int> active_level(-1);
+
+SimdLevel DetectSimdLevelUncached() {
+#if (defined(__GNUC__) || defined(__clang__)) && \
+        (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return SimdLevel::kAvx512;
+    if (__builtin_cpu_supports("avx2"))
+        return SimdLevel::kAvx2;
+    if (__builtin_cpu_supports("sse4.1"))
+        return SimdLevel::kSse41;
+#endif
+    return SimdLevel::kScalar;
+}
+
+} // namespace
+
+const char *SimdLevelName(const SimdLevel level) {
+    switch (level) {
+    case SimdLevel::kScalar:
+        return "scalar";
+    case SimdLevel::kSse41:
+        return "sse4.1";
+    case SimdLevel::kAvx2:
+        return "avx2";
+    case SimdLevel::kAvx512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+SimdLevel DetectSimdLevel() {
+    static const SimdLevel detected = DetectSimdLevelUncached();
+    return detected;
+}
+
+SimdLevel ActiveSimdLevel() {
+    int level = active_level.load(std::memory_order_relaxed);
+    if (level < 0) {
+        // Don't overwrite a level set by another thread in the meantime
+        int detected = (int)DetectSimdLevel();
+        if (active_level.compare_exchange_strong(level, detected))
+            level = detected;
+    }
+    return (SimdLevel)level;
+}
+
+SimdLevel SetSimdLevel(const SimdLevel level) {
+    SimdLevel clamped = (int)level < (int)DetectSimdLevel() ?
+        level : DetectSimdLevel();
+    active_level.store((int)clamped, std::memory_order_relaxed);
+    return clamped;
+}
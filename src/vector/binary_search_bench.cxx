@@ -0,0 +1,62 @@
+/** Benchmarks for `binary_search.hpp`
+ *
+ * Each iteration looks up as many random values as the sorted table has
+ * items, so the time per item is the time per lookup. Tables bigger than
+ * the cache show the memory latency that prefetching and batching hide.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/vector/binary_search.hpp"
+
+
+namespace {
+
+/** Run a lookup function on a sorted table and random values. */
+template <typename LookupFunction>
+void RunLookupBenchmark(BenchmarkState &state, LookupFunction lookup) {
+    auto table = GenerateBenchmarkInput(state.size(), state.distribution());
+    std::sort(table.begin(), table.end());
+    auto values = GenerateBenchmarkInput(
+        state.size(), InputDistribution::kRandom);
+    std::vector<std::vector<int>::const_iterator> positions(values.size());
+    while (state.KeepRunning())
+        lookup(table, values, positions);
+}
+
+void BM_StdLowerBound(BenchmarkState &state) {
+    RunLookupBenchmark(state, [](
+            const std::vector<int> &table, const std::vector<int> &values,
+            std::vector<std::vector<int>::const_iterator> &positions) {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            positions[i] = std::lower_bound(
+                table.begin(), table.end(), values[i]);
+    });
+}
+
+void BM_LowerBound(BenchmarkState &state) {
+    RunLookupBenchmark(state, [](
+            const std::vector<int> &table, const std::vector<int> &values,
+            std::vector<std::vector<int>::const_iterator> &positions) {
+        for (std::size_t i = 0; i < values.size(); ++i)
+            positions[i] = LowerBound(table.begin(), table.end(), values[i]);
+    });
+}
+
+void BM_BatchedLowerBound(BenchmarkState &state) {
+    RunLookupBenchmark(state, [](
+            const std::vector<int> &table, const std::vector<int> &values,
+            std::vector<std::vector<int>::const_iterator> &positions) {
+        BatchedLowerBound(table.begin(), table.end(), values.begin(),
+                          values.end(), positions.begin());
+    });
+}
+
+} // namespace
+
+BENCHMARK(BM_StdLowerBound)->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_LowerBound)->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_BatchedLowerBound)->Distributions({InputDistribution::kRandom});
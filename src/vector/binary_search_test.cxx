@@ -0,0 +1,82 @@
+/** Unit tests for `binary_search.hpp`
+ */
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/vector/binary_search.hpp"
+#include "algorithm/vector/search.hpp"
+
+
+TEST(BinarySearchTest, BoundsMatchStandardLibrary) {
+    for (int size : {0, 1, 2, 3, 7, 8, 100, 1000}) {
+        std::vector<int> vec(size);
+        RandomlyFillVector(vec, -50, 50);
+        std::sort(vec.begin(), vec.end());
+        for (int value = -52; value <= 52; ++value) {
+            int lower = std::lower_bound(vec.begin(), vec.end(), value) -
+                        vec.begin();
+            int upper = std::upper_bound(vec.begin(), vec.end(), value) -
+                        vec.begin();
+            ASSERT_EQ(LowerBound(vec, value), lower)
+                << "Wrong lower bound of " << value << " in size " << size;
+            ASSERT_EQ(UpperBound(vec, value), upper)
+                << "Wrong upper bound of " << value << " in size " << size;
+            ASSERT_EQ(EqualRange(vec, value), std::make_tuple(lower, upper))
+                << "Wrong equal range of " << value << " in size " << size;
+        }
+    }
+}
+
+TEST(BinarySearchTest, BatchedBoundsMatchSingleOnes) {
+    for (int size : {0, 1, 5, 1000}) {
+        std::vector<int> vec(size);
+        RandomlyFillVector(vec, -500, 500);
+        std::sort(vec.begin(), vec.end());
+        // Not a multiple of the batch size, so the last batch is partial
+        std::vector<int> values(kBinarySearchBatchSize * 3 + 5);
+        RandomlyFillVector(values, -510, 510);
+
+        std::vector<int> expected_lower, expected_upper;
+        for (int value : values) {
+            expected_lower.push_back(LowerBound(vec, value));
+            expected_upper.push_back(UpperBound(vec, value));
+        }
+        EXPECT_EQ(BatchedLowerBound(vec, values), expected_lower)
+            << "Batched lower bounds disagree in size " << size;
+
+        std::vector<std::vector<int>::iterator> upper(values.size());
+        auto output_end = BatchedUpperBound(
+            vec.begin(), vec.end(), values.begin(), values.end(),
+            upper.begin());
+        EXPECT_EQ(output_end, upper.end());
+        for (std::size_t i = 0; i < values.size(); ++i)
+            EXPECT_EQ(upper[i] - vec.begin(), expected_upper[i])
+                << "Batched upper bound disagrees for " << values[i];
+    }
+}
+
+TEST(BinarySearchTest, UsesComparatorAndProjection) {
+    // Sorted by descending length
+    std::vector<std::string> words = {
+        "banana", "cherry", "apple", "kiwi", "pear", "plum", "fig"};
+    auto by_length = [](const std::string &word) { return word.size(); };
+    auto range = EqualRange(
+        words.begin(), words.end(), 4u, Greater(), by_length);
+    EXPECT_EQ(range.first - words.begin(), 3);
+    EXPECT_EQ(range.second - words.begin(), 6);
+}
+
+TEST(BinarySearchTest, FindsFirstOfRepeatedValues) {
+    std::vector<int> vec = {1, 3, 3, 3, 5, 8, 8};
+    EXPECT_EQ(BinarySearch(vec, 0, (int)vec.size(), 3), 1);
+    EXPECT_EQ(BinarySearch(vec, 0, (int)vec.size(), 8), 5);
+    EXPECT_EQ(BinarySearch(vec, 2, (int)vec.size(), 3), 2);
+    EXPECT_THROW(BinarySearch(vec, 0, 5, 8), std::runtime_error);
+    EXPECT_THROW(BinarySearch(vec, 0, (int)vec.size(), 4), std::runtime_error);
+}
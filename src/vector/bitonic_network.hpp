@@ -0,0 +1,103 @@
+/** Bitonic sorting networks over SIMD registers (internal to the sorting
+ * network code).
+ *
+ * The network is written once against a small set of register operations
+ * (`Ops`), and each instruction set's source file instantiates it with its own
+ * operations: plain ints, 4-int SSE registers or 8-int AVX2 registers.
+ *
+ * An `Ops` class provides:
+ * - `Register`, the register type, and `kLanes`, the ints per register;
+ * - `Load(const int *)` and `Store(int *, Register)`, unaligned;
+ * - `Min(a, b)` and `Max(a, b)`, lane by lane;
+ * - `PermuteLanes(v, x)`, which swaps each lane i with lane i ^ x;
+ * - `CompareExchangeLanes(v, x)`, which compare-exchanges each lane i with
+ *   lane i ^ x (x > 0), leaving the smaller int in the lower lane.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_BITONIC_NETWORK_HPP
+#define ALGORITHMS_STUDY_CPP_BITONIC_NETWORK_HPP
+
+
+namespace detail {
+
+/** Compare-exchange every item i with item i ^ `partner_xor`, leaving the
+ * smaller one in the lower position.
+ */
+template <typename Ops, int kNumRegisters>
+inline void CompareExchangeXor(
+        typename Ops::Register *regs, const int partner_xor) {
+    const int register_xor = partner_xor / Ops::kLanes;
+    const int lane_xor = partner_xor % Ops::kLanes;
+    if (register_xor == 0) {
+        for (int r = 0; r < kNumRegisters; ++r)
+            regs[r] = Ops::CompareExchangeLanes(regs[r], lane_xor);
+        return;
+    }
+    // The partner is in another register, and its lanes are permuted so that
+    // both sides of each pair are in the same lane
+    for (int r = 0; r < kNumRegisters; ++r) {
+        int partner = r ^ register_xor;
+        if (partner < r)
+            continue;
+        typename Ops::Register other =
+            Ops::PermuteLanes(regs[partner], lane_xor);
+        typename Ops::Register larger = Ops::Max(regs[r], other);
+        regs[r] = Ops::Min(regs[r], other);
+        regs[partner] = Ops::PermuteLanes(larger, lane_xor);
+    }
+}
+
+/** Sort `kSize` ints (in-place) with a bitonic network.
+ *
+ * This is the variant of the network that never sorts in descending order:
+ * each block of 2k items is merged from two sorted blocks of k by comparing
+ * item i with item 2k - 1 - i (which "flips" the second block), and then
+ * half-cleaning with distances k / 2, k / 4, ..., 1.
+ */
+template <typename Ops, int kSize>
+inline void BitonicSort(int *data) {
+    const int num_registers = kSize / Ops::kLanes;
+    typename Ops::Register regs[num_registers];
+    for (int r = 0; r < num_registers; ++r)
+        regs[r] = Ops::Load(data + r * Ops::kLanes);
+
+    for (int block = 2; block <= kSize; block *= 2) {
+        CompareExchangeXor<Ops, num_registers>(regs, block - 1);
+        for (int distance = block / 4; distance > 0; distance /= 2)
+            CompareExchangeXor<Ops, num_registers>(regs, distance);
+    }
+
+    for (int r = 0; r < num_registers; ++r)
+        Ops::Store(data + r * Ops::kLanes, regs[r]);
+}
+
+/** Sort 8, 16, 32 or 64 ints (in-place) with a bitonic network.
+ */
+template <typename Ops>
+void BitonicSortNetwork(int *data, const int size) {
+    switch (size) {
+    case 8:
+        BitonicSort<Ops, 8>(data);
+        break;
+    case 16:
+        BitonicSort<Ops, 16>(data);
+        break;
+    case 32:
+        BitonicSort<Ops, 32>(data);
+        break;
+    case 64:
+        BitonicSort<Ops, 64>(data);
+        break;
+    }
+}
+
+// One entry point per instruction set, each taking 8, 16, 32 or 64 ints. The
+// vector versions fall back on the scalar one in builds without their
+// instruction set.
+void SortingNetworkScalar(int *data, const int size);
+void SortingNetworkSse41(int *data, const int size);
+void SortingNetworkAvx2(int *data, const int size);
+
+} // namespace detail
+
+#endif //ALGORITHMS_STUDY_CPP_BITONIC_NETWORK_HPP
@@ -0,0 +1,100 @@
+/** In-place SIMD partition kernel (internal to the vectorized partition
+ * code).
+ *
+ * Written once against a small set of register operations (`Ops`), and
+ * instantiated by each instruction set's source file. An `Ops` class
+ * provides:
+ * - `Register`, the register type, and `kLanes`, the ints per register;
+ * - `Load(const int *)` (unaligned) and `Broadcast(int)`;
+ * - `StoreSplit(items, pivots, equality_check, left, right)`, which stores
+ *   the items going left starting at `left` and those going right ending just
+ *   before `right`, and returns how many went left. It may write anything to
+ *   the rest of `[left, left + kLanes)` and `[right - kLanes, right)`.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_COMPRESS_PARTITION_HPP
+#define ALGORITHMS_STUDY_CPP_COMPRESS_PARTITION_HPP
+
+#include <cstddef>
+
+
+namespace detail {
+
+/** Ints per register of the AVX2 and AVX-512 partitions. */
+const int kAvx2Lanes = 8;
+const int kAvx512Lanes = 16;
+
+/** Partition `[first, last)` around `pivot`, a register at a time.
+ *
+ * One register's worth of items is set aside from each end, which leaves
+ * `2 kLanes` free slots between the partitioned items and the unread ones.
+ * Each step then reads a register from whichever end has fewer free slots,
+ * so both ends have at least `kLanes` free before its items are stored. The
+ * items set aside are stored last, into exactly the space that is left.
+ *
+ * The range must hold at least `2 kLanes` ints.
+ *
+ * @return  Pointer to the first int of the right partition.
+ */
+template <typename Ops>
+int *CompressPartition(
+        int *first, int *last, const int pivot, const bool equality_check) {
+    const int lanes = Ops::kLanes;
+    typename Ops::Register pivots = Ops::Broadcast(pivot);
+    typename Ops::Register first_items = Ops::Load(first);
+    typename Ops::Register last_items = Ops::Load(last - lanes);
+
+    int *left_write = first;
+    int *left_read = first + lanes;
+    int *right_read = last - lanes;
+    int *right_write = last;
+
+    // Take the odd items one at a time, so whole registers are left; there
+    // are fewer than `lanes` of them, so neither end can run out of space
+    for (std::ptrdiff_t i = (right_read - left_read) % lanes; i > 0; --i) {
+        int item = *left_read++;
+        bool goes_left = equality_check ? !(pivot < item) : item < pivot;
+        if (goes_left)
+            *left_write++ = item;
+        else
+            *--right_write = item;
+    }
+
+    while (left_read != right_read) {
+        typename Ops::Register items;
+        if (left_read - left_write <= right_write - right_read) {
+            items = Ops::Load(left_read);
+            left_read += lanes;
+        }
+        else {
+            right_read -= lanes;
+            items = Ops::Load(right_read);
+        }
+        int num_left = Ops::StoreSplit(
+            items, pivots, equality_check, left_write, right_write);
+        left_write += num_left;
+        right_write -= lanes - num_left;
+    }
+
+    int num_left = Ops::StoreSplit(
+        first_items, pivots, equality_check, left_write, right_write);
+    left_write += num_left;
+    right_write -= lanes - num_left;
+    num_left = Ops::StoreSplit(
+        last_items, pivots, equality_check, left_write, right_write);
+    return left_write + num_left;
+}
+
+// One entry point per instruction set, each taking at least two registers'
+// worth of ints. The vector versions fall back on the scalar one in builds
+// without their instruction set.
+int *VectorizedPartitionScalar(
+        int *first, int *last, const int pivot, const bool equality_check);
+int *VectorizedPartitionAvx2(
+        int *first, int *last, const int pivot, const bool equality_check);
+int *VectorizedPartitionAvx512(
+        int *first, int *last, const int pivot, const bool equality_check);
+
+} // namespace detail
+
+#endif //ALGORITHMS_STUDY_CPP_COMPRESS_PARTITION_HPP
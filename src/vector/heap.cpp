@@ -24,67 +24,32 @@ int Parent(const int node) {
 }
 
 void MaxHeapify(std::vector<int> &heap, const int node, const int heap_order) {
-    int left_child = LeftChild(node);
-    int right_child = RightChild(node);
-
-    int largest_node;
-    if (left_child < heap_order && heap[left_child] > heap[node]) {
-        largest_node = left_child;
-    }
-    else {
-        largest_node = node;
-    }
-    if (right_child < heap_order && heap[right_child] > heap[largest_node]) {
-        largest_node = right_child;
-    }
-
-    if (largest_node != node) {
-        std::swap(heap[node], heap[largest_node]);
-        MaxHeapify(heap, largest_node, heap_order);
-    }
+    MaxHeapify(heap.begin(), node, heap_order);
 }
 
 void MinHeapify(std::vector<int> &heap, const int node, const int heap_order) {
-    int left_child = LeftChild(node);
-    int right_child = RightChild(node);
-
-    int smallest_node;
-    if (left_child < heap_order && heap[left_child] < heap[node])
-        smallest_node = left_child;
-    else
-        smallest_node = node;
-    if (right_child < heap_order && heap[right_child] < heap[smallest_node])
-        smallest_node = right_child;
-
-    if (smallest_node != node) {
-        std::swap(heap[node], heap[smallest_node]);
-        MinHeapify(heap, smallest_node, heap_order);
-    }
+    MinHeapify(heap.begin(), node, heap_order);
 }
 
 void MaxHeapBuilder(std::vector<int> &vec) {
-    for (int i = (int)std::floor((vec.size() - 1)/2.); i >= 0; --i)
-        MaxHeapify(vec, i, vec.size());
+    MaxHeapBuilder(vec.begin(), vec.end());
 }
 
 void MinHeapBuilder(std::vector<int> &vec) {
-    for (int i = (int)std::floor((vec.size() - 1)/2.); i >= 0; --i)
-        MinHeapify(vec, i, vec.size());
+    MinHeapBuilder(vec.begin(), vec.end());
 }
 
 int MaxHeapExtractMax(std::vector<int> &max_heap) {
-    auto max = max_heap[0];
-    max_heap[0] = max_heap[max_heap.size() - 1];
+    MaxHeapExtractMax(max_heap.begin(), max_heap.end());
+    auto max = max_heap.back();
     max_heap.pop_back();
-    MaxHeapify(max_heap, 0, max_heap.size());
     return max;
 }
 
 int MinHeapExtractMin(std::vector<int> &min_heap) {
-    auto min = min_heap[0];
-    min_heap[0] = min_heap[min_heap.size() - 1];
+    MinHeapExtractMin(min_heap.begin(), min_heap.end());
+    auto min = min_heap.back();
     min_heap.pop_back();
-    MinHeapify(min_heap, 0, min_heap.size());
     return min;
 }
 
@@ -118,17 +83,13 @@ void MinHeapDecreaseKey(
 }
 
 void MaxHeapInsert(std::vector<int> &max_heap, const int key) {
-    // First append "negative infinity" to the end of the vector
-    max_heap.push_back(-std::numeric_limits<int>::max());
-    // Then increase this key to the appropriate value
-    MaxHeapIncreaseKey(max_heap, max_heap.size() - 1, key);
+    max_heap.push_back(key);
+    MaxHeapInsert(max_heap.begin(), max_heap.end());
 }
 
 void MinHeapInsert(std::vector<int> &min_heap, const int key) {
-    // First append "postive infinity" to the end of the vector
-    min_heap.push_back(std::numeric_limits<int>::max());
-    // Then increase this key to the appropriate value
-    MinHeapDecreaseKey(min_heap, min_heap.size() - 1, key);
+    min_heap.push_back(key);
+    MinHeapInsert(min_heap.begin(), min_heap.end());
 }
 
 void MaxHeapDelete(std::vector<int> &max_heap, const int node) {
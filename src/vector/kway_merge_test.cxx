@@ -0,0 +1,110 @@
+/** Unit tests for `kway_merge.hpp`
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/vector/kway_merge.hpp"
+
+
+namespace {
+
+const MergeStrategy kStrategies[] = {
+    MergeStrategy::kLoserTree, MergeStrategy::kHeap};
+
+/** An item tagged with the run it came from. */
+struct RunItem {
+    int key;
+    int run;
+
+    bool operator==(const RunItem &other) const {
+        return key == other.key && run == other.run;
+    }
+};
+
+struct RunItemKey {
+    int operator()(const RunItem &item) const {
+        return item.key;
+    }
+};
+
+} // namespace
+
+TEST(KwayMergeTest, MergesAnyNumberOfRuns) {
+    for (MergeStrategy strategy : kStrategies)
+        for (int num_runs = 0; num_runs <= 17; ++num_runs) {
+            std::vector<std::vector<int>> runs(num_runs);
+            std::vector<int> expected_vec;
+            for (auto &run : runs) {
+                // Some runs are empty
+                run.resize(RandomInteger(0, 50));
+                RandomlyFillVector(run, -100, 100);
+                std::sort(run.begin(), run.end());
+                expected_vec.insert(
+                    expected_vec.end(), run.begin(), run.end());
+            }
+            std::sort(expected_vec.begin(), expected_vec.end());
+
+            EXPECT_EQ(
+                MergeSortedVectors(runs, Less(), Identity(), strategy),
+                expected_vec)
+                << "Failed to merge " << num_runs << " runs!";
+        }
+}
+
+TEST(KwayMergeTest, MergesStably) {
+    std::vector<std::vector<RunItem>> runs(5);
+    for (int run = 0; run < (int)runs.size(); ++run) {
+        std::vector<int> keys(RandomInteger(0, 100));
+        RandomlyFillVector(keys, 0, 9);
+        std::sort(keys.begin(), keys.end());
+        for (int key : keys)
+            runs[run].push_back({key, run});
+    }
+
+    // Equal keys come out in run order
+    std::vector<RunItem> expected_vec;
+    for (const auto &run : runs)
+        expected_vec.insert(expected_vec.end(), run.begin(), run.end());
+    std::stable_sort(
+        expected_vec.begin(), expected_vec.end(),
+        [](const RunItem &a, const RunItem &b) { return a.key < b.key; });
+
+    for (MergeStrategy strategy : kStrategies)
+        EXPECT_EQ(
+            MergeSortedVectors(runs, Less(), RunItemKey(), strategy),
+            expected_vec)
+            << "Merge of equal keys was not stable!";
+}
+
+TEST(KwayMergeTest, UsesComparator) {
+    std::vector<std::vector<int>> runs = {{9, 5, 1}, {8, 2}, {}, {7, 6, 3}};
+    std::vector<int> expected_vec = {9, 8, 7, 6, 5, 3, 2, 1};
+    for (MergeStrategy strategy : kStrategies)
+        EXPECT_EQ(
+            MergeSortedVectors(runs, Greater(), Identity(), strategy),
+            expected_vec)
+            << "Merge with a descending comparator failed!";
+}
+
+TEST(KwayMergeTest, MergesStreams) {
+    for (MergeStrategy strategy : kStrategies) {
+        std::istringstream a("1 4 4 9"), b(""), c("0 2 5 10 11"), d("3");
+        typedef std::istream_iterator<int> StreamIt;
+        std::vector<std::pair<StreamIt, StreamIt>> runs = {
+            {StreamIt(a), StreamIt()}, {StreamIt(b), StreamIt()},
+            {StreamIt(c), StreamIt()}, {StreamIt(d), StreamIt()}};
+
+        std::vector<int> merged;
+        MultiwayMerge(
+            runs, std::back_inserter(merged), Less(), Identity(), strategy);
+        EXPECT_EQ(merged, std::vector<int>({0, 1, 2, 3, 4, 4, 5, 9, 10, 11}))
+            << "Failed to merge runs read from streams!";
+    }
+}
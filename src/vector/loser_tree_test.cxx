@@ -0,0 +1,74 @@
+/** Unit tests for `loser_tree.hpp`
+ */
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/vector/loser_tree.hpp"
+
+
+namespace {
+
+/** Merge sorted runs with a loser tree, recording (key, run) pairs. */
+std::vector<std::pair<int, int>> MergeWithLoserTree(
+        const std::vector<std::vector<int>> &runs) {
+    int num_runs = (int)runs.size();
+    std::vector<std::size_t> next(num_runs, 0);
+    LoserTree<int> tree(num_runs);
+    for (int run = 0; run < num_runs; ++run)
+        if (!runs[run].empty())
+            tree.SetKey(run, runs[run][next[run]++]);
+    tree.Build();
+
+    std::vector<std::pair<int, int>> merged;
+    while (!tree.Empty()) {
+        int run = tree.Winner();
+        merged.push_back(std::make_pair(tree.WinnerKey(), run));
+        if (next[run] < runs[run].size())
+            tree.ReplaceWinner(runs[run][next[run]++]);
+        else
+            tree.RemoveWinner();
+    }
+    return merged;
+}
+
+} // namespace
+
+TEST(LoserTreeTest, MergesAnyNumberOfRuns) {
+    for (int num_runs = 1; num_runs <= 17; ++num_runs) {
+        std::vector<std::vector<int>> runs(num_runs);
+        std::vector<int> expected_vec;
+        for (auto &run : runs) {
+            // Some runs are empty
+            run.resize(RandomInteger(0, 50));
+            RandomlyFillVector(run, -100, 100);
+            std::sort(run.begin(), run.end());
+            expected_vec.insert(expected_vec.end(), run.begin(), run.end());
+        }
+        std::sort(expected_vec.begin(), expected_vec.end());
+
+        std::vector<int> merged_vec;
+        for (const auto &item : MergeWithLoserTree(runs))
+            merged_vec.push_back(item.first);
+        EXPECT_EQ(merged_vec, expected_vec)
+            << "Merging " << num_runs << " runs failed!";
+    }
+}
+
+TEST(LoserTreeTest, TiesGoToTheEarlierRun) {
+    std::vector<std::vector<int>> runs = {{1, 2, 2}, {2, 3}, {1, 2}};
+    std::vector<std::pair<int, int>> expected = {
+        {1, 0}, {1, 2}, {2, 0}, {2, 0}, {2, 1}, {2, 2}, {3, 1}};
+    EXPECT_EQ(MergeWithLoserTree(runs), expected)
+        << "Equal keys must come out in run order!";
+}
+
+TEST(LoserTreeTest, AllRunsEmpty) {
+    LoserTree<int> tree(4);
+    tree.Build();
+    EXPECT_TRUE(tree.Empty()) << "A tree of exhausted runs must be empty!";
+}
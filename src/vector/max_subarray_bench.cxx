@@ -0,0 +1,64 @@
+/** Benchmarks for `max_subarray.hpp`
+ *
+ * The parallel runs use the run's argument as the thread count; the pool is
+ * started once, outside the timed region.
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/vector/max_subarray.hpp"
+#include "algorithm/vector/search.hpp"
+
+
+namespace {
+
+/** Generate the input, shifted to be about half negative (else the maximum
+ * subarray would be all of it).
+ */
+std::vector<int> GenerateCenteredInput(BenchmarkState &state) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    for (int &item : input)
+        item -= (int)(state.size() / 2);
+    return input;
+}
+
+void BM_FindMaxSubvector(BenchmarkState &state) {
+    auto input = GenerateCenteredInput(state);
+    long long sum = 0;
+    while (state.KeepRunning())
+        sum += std::get<2>(FindMaxSubvector(input, 0, (int)input.size()));
+    volatile long long result = sum;
+    (void)result;
+}
+
+void BM_SummarizeSubarrays(BenchmarkState &state) {
+    auto input = GenerateCenteredInput(state);
+    long long sum = 0;
+    while (state.KeepRunning())
+        sum += SummarizeSubarrays(input.begin(), input.end()).best;
+    volatile long long result = sum;
+    (void)result;
+}
+
+void BM_ParallelSummarizeSubarrays(BenchmarkState &state) {
+    auto input = GenerateCenteredInput(state);
+    ThreadPool pool(state.argument());
+    long long sum = 0;
+    while (state.KeepRunning())
+        sum += ParallelSummarizeSubarrays(
+            input.begin(), input.end(), pool).best;
+    volatile long long result = sum;
+    (void)result;
+}
+
+} // namespace
+
+BENCHMARK(BM_FindMaxSubvector)->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_SummarizeSubarrays)
+    ->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_ParallelSummarizeSubarrays)
+    ->Distributions({InputDistribution::kRandom})->Arguments({1, 2, 4});
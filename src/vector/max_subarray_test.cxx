@@ -0,0 +1,138 @@
+/** Unit tests for `max_subarray.hpp`
+ */
+
+#include <algorithm>
+#include <climits>
+#include <ctime>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/random.hpp"
+#include "algorithm/vector/max_subarray.hpp"
+#include "algorithm/vector/search.hpp"
+
+
+/** Randomized test fixture for the maximum subarray summaries.
+ */
+class MaxSubarrayTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        std::srand((unsigned int)std::time(nullptr)); // Seed the RNG
+    }
+
+    /** Return the first (then shortest) subarray with the largest sum, as
+     * (begin, end, sum), by trying them all.
+     */
+    std::tuple<std::size_t, std::size_t, long long> BruteForce(
+            const std::vector<int> &vec) {
+        std::tuple<std::size_t, std::size_t, long long> best(0, 1, vec[0]);
+        for (std::size_t begin = 0; begin < vec.size(); ++begin) {
+            long long sum = 0;
+            for (std::size_t end = begin + 1; end <= vec.size(); ++end) {
+                sum += vec[end - 1];
+                if (sum > std::get<2>(best))
+                    best = std::make_tuple(begin, end, sum);
+            }
+        }
+        return best;
+    }
+
+    /** Check a summary's best subarray is the brute force one. */
+    void ExpectBest(
+            const SubarraySummary<> &summary, const std::vector<int> &vec,
+            const std::string &error_msg) {
+        auto expected = BruteForce(vec);
+        EXPECT_EQ(summary.size, vec.size()) << error_msg;
+        EXPECT_EQ(std::make_tuple(summary.best_begin, summary.best_end,
+                                  summary.best), expected) << error_msg;
+    }
+};
+
+TEST_F(MaxSubarrayTest, SummaryMatchesBruteForce) {
+    for (int size = 1; size <= 40; ++size) {
+        // Small values, so there are many ties
+        std::vector<int> vec(size);
+        RandomlyFillVector(vec, -3, 3);
+        auto summary = SummarizeSubarrays(vec.begin(), vec.end());
+        ExpectBest(summary, vec, "Wrong best subarray.");
+
+        long long total = 0;
+        for (int item : vec)
+            total += item;
+        EXPECT_EQ(summary.total, total) << "Wrong total.";
+    }
+}
+
+TEST_F(MaxSubarrayTest, CombiningAnySplitMatchesOnePass) {
+    std::vector<int> vec(30);
+    RandomlyFillVector(vec, -3, 3);
+    auto whole = SummarizeSubarrays(vec.begin(), vec.end());
+    for (std::size_t split = 0; split <= vec.size(); ++split) {
+        auto both = CombineSubarraySummaries(
+            SummarizeSubarrays(vec.begin(), vec.begin() + split),
+            SummarizeSubarrays(vec.begin() + split, vec.end()));
+        EXPECT_EQ(std::make_tuple(both.size, both.total, both.prefix,
+                                  both.prefix_end, both.suffix,
+                                  both.suffix_begin),
+                  std::make_tuple(whole.size, whole.total, whole.prefix,
+                                  whole.prefix_end, whole.suffix,
+                                  whole.suffix_begin))
+            << "Split at " << split << " changed the summary.";
+        EXPECT_EQ(std::make_tuple(both.best, both.best_begin, both.best_end),
+                  std::make_tuple(whole.best, whole.best_begin,
+                                  whole.best_end))
+            << "Split at " << split << " changed the best subarray.";
+    }
+}
+
+TEST_F(MaxSubarrayTest, ParallelMatchesBruteForce) {
+    std::vector<int> vec(RandomInteger(300, 600));
+    RandomlyFillVector(vec, -20, 20);
+    for (int num_threads : {1, 2, 4, 7}) {
+        ThreadPool pool(num_threads);
+        for (int grain_size : {1, 7, 64, kMaxSubarrayGrainSize}) {
+            auto summary = ParallelSummarizeSubarrays(
+                vec.begin(), vec.end(), pool, grain_size);
+            ExpectBest(summary, vec, "Wrong parallel best subarray.");
+        }
+    }
+
+    auto result = ParallelFindMaxSubvector(vec, 0, (int)vec.size(), 4, 16);
+    auto expected = BruteForce(vec);
+    EXPECT_EQ(std::get<0>(result), (int)std::get<0>(expected));
+    EXPECT_EQ(std::get<1>(result), (int)std::get<1>(expected));
+    EXPECT_EQ(std::get<2>(result), std::get<2>(expected));
+}
+
+TEST_F(MaxSubarrayTest, StreamingInPiecesMatchesBruteForce) {
+    std::vector<int> vec(RandomInteger(100, 200));
+    RandomlyFillVector(vec, -20, 20);
+    StreamingMaxSubarray<> stream;
+    for (std::size_t begin = 0; begin < vec.size(); ) {
+        std::size_t end = std::min(
+            vec.size(), begin + (std::size_t)RandomInteger(0, 10));
+        stream.Push(vec.begin() + begin, vec.begin() + end);
+        begin = end;
+    }
+    ExpectBest(stream.summary(), vec, "Wrong streaming best subarray.");
+}
+
+TEST_F(MaxSubarrayTest, HandlesNegativeAndExtremeValues) {
+    // All negative: the largest item, first of its equals
+    std::vector<int> negative = {-5, -2, -7, -2, -9};
+    auto summary = SummarizeSubarrays(negative.begin(), negative.end());
+    EXPECT_EQ(std::make_tuple(summary.best_begin, summary.best_end,
+                              summary.best),
+              std::make_tuple((std::size_t)1, (std::size_t)2, -2LL));
+
+    // Sums that overflow an int
+    std::vector<int> large(16, INT_MAX);
+    ThreadPool pool(4);
+    summary = ParallelSummarizeSubarrays(large.begin(), large.end(), pool, 2);
+    EXPECT_EQ(summary.best, 16LL * INT_MAX);
+    EXPECT_EQ(summary.best_end, large.size());
+}
@@ -0,0 +1,31 @@
+#include <vector>
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/vector/parallel_sort.hpp"
+
+
+void ParallelMergeSort(
+        std::vector<int> &vec, const int num_threads /*= 0*/,
+        const int grain_size /*= kDefaultParallelGrainSize*/) {
+    ThreadPool pool(num_threads);
+    ParallelMergeSort(vec.begin(), vec.end(), pool, grain_size);
+}
+
+void ParallelQuicksort(
+        std::vector<int> &vec, const int num_threads /*= 0*/,
+        const int grain_size /*= kDefaultParallelGrainSize*/) {
+    ThreadPool pool(num_threads);
+    ParallelQuicksort(vec.begin(), vec.end(), pool, grain_size);
+}
+
+std::vector<int> ParallelCountingSort(
+        std::vector<int> &input_vec, const int min, const int max,
+        const int num_threads /*= 0*/,
+        const int grain_size /*= kDefaultParallelGrainSize*/) {
+    ThreadPool pool(num_threads);
+    std::vector<int> output_vec(input_vec.size());
+    ParallelCountingSort(
+        input_vec.begin(), input_vec.end(), output_vec.begin(), min, max,
+        pool, grain_size);
+    return output_vec;
+}
@@ -0,0 +1,101 @@
+/** Benchmarks for `parallel_sort.cpp`
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/vector/parallel_sort.hpp"
+#include "algorithm/vector/sample_sort.hpp"
+
+
+namespace {
+
+/** Thread counts for scaling runs: 1, 2, 4, ... up to the number of cores.
+ */
+std::vector<int> ScalingThreadCounts() {
+    std::vector<int> thread_counts;
+    int max_threads = ResolveThreadCount(0);
+    for (int num_threads = 1; num_threads < max_threads; num_threads *= 2)
+        thread_counts.push_back(num_threads);
+    thread_counts.push_back(max_threads);
+    return thread_counts;
+}
+
+/** Time a parallel sort, using the run's argument as the thread count.
+ *
+ * The pool is started once, outside the timed region.
+ */
+void BM_ParallelMergeSort(BenchmarkState &state) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    ThreadPool pool(state.argument());
+    std::vector<int> buffer(input.size());
+    std::vector<int> vec;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+        ParallelMergeSortWithBuffer(vec.begin(), vec.end(), buffer.begin(), pool);
+    }
+    state.SetCounter("threads", pool.NumThreads());
+}
+
+void BM_ParallelQuicksort(BenchmarkState &state) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    ThreadPool pool(state.argument());
+    std::vector<int> vec;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+        ParallelQuicksort(vec.begin(), vec.end(), pool);
+    }
+    state.SetCounter("threads", pool.NumThreads());
+}
+
+/** Counting sort of keys in [0, 65536), like a column of status codes.
+ */
+void BM_ParallelCountingSort(BenchmarkState &state) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    for (int &item : input)
+        item &= 0xffff;
+    ThreadPool pool(state.argument());
+    std::vector<int> output(input.size());
+    while (state.KeepRunning())
+        ParallelCountingSort(
+            input.begin(), input.end(), output.begin(), 0, 0xffff, pool);
+    state.SetCounter("threads", pool.NumThreads());
+}
+
+void BM_SampleSort(BenchmarkState &state) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    ThreadPool pool(state.argument());
+    std::vector<int> vec;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+        SampleSort(vec.begin(), vec.end(), pool);
+    }
+    state.SetCounter("threads", pool.NumThreads());
+}
+
+} // namespace
+
+BENCHMARK(BM_ParallelMergeSort)
+    ->MinSize(10000)
+    ->Distributions({InputDistribution::kRandom, InputDistribution::kSorted})
+    ->Arguments(ScalingThreadCounts());
+BENCHMARK(BM_ParallelQuicksort)
+    ->MinSize(10000)
+    ->Distributions({InputDistribution::kRandom, InputDistribution::kFewUnique})
+    ->Arguments(ScalingThreadCounts());
+BENCHMARK(BM_ParallelCountingSort)
+    ->MinSize(100000)
+    ->Distributions({InputDistribution::kRandom, InputDistribution::kFewUnique})
+    ->Arguments(ScalingThreadCounts());
+BENCHMARK(BM_SampleSort)
+    ->MinSize(10000)
+    ->Distributions({InputDistribution::kRandom, InputDistribution::kFewUnique})
+    ->Arguments(ScalingThreadCounts());
@@ -0,0 +1,176 @@
+/** Unit tests for `parallel_sort.cpp`
+ */
+
+#include <algorithm>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/vector/parallel_sort.hpp"
+#include "algorithm/random.hpp"
+
+
+/** Randomized test fixture for parallel sort algorithms.
+ *
+ * The vector is large enough to be split many times with a small grain size.
+ */
+class RandomizedParallelSortingTest: public ::testing::Test {
+public:
+    std::vector<int> random_vec;
+    std::vector<int> sorted_vec;
+
+protected:
+    virtual void SetUp() {
+        std::srand((unsigned int)std::time(nullptr)); // Seed the RNG
+
+        int random_size = RandomInteger(1000, 20000);
+        random_vec = std::vector<int>((unsigned int)random_size);
+        RandomlyFillVector(random_vec, -100, 100);
+
+        sorted_vec = random_vec;
+        std::sort(sorted_vec.begin(), sorted_vec.end());
+    }
+};
+
+TEST(ParallelSortingTest, PreservesSmallVectors) {
+    std::vector<int> empty;
+    std::vector<int> singleton = {5};
+
+    ParallelMergeSort(empty, 4, 1);
+    EXPECT_TRUE(empty.empty()) << "An empty vector should stay empty!";
+    ParallelMergeSort(singleton, 4, 1);
+    EXPECT_EQ(singleton, std::vector<int>{5})
+        << "A singleton should not change when sorted!";
+
+    ParallelQuicksort(empty, 4, 1);
+    EXPECT_TRUE(empty.empty()) << "An empty vector should stay empty!";
+    ParallelQuicksort(singleton, 4, 1);
+    EXPECT_EQ(singleton, std::vector<int>{5})
+        << "A singleton should not change when sorted!";
+}
+
+TEST_F(RandomizedParallelSortingTest, MergeSortCorrectlySortsRandomVector) {
+    for (int num_threads : {1, 2, 4, 7}) {
+        for (int grain_size : {1, 64, kDefaultParallelGrainSize}) {
+            auto test_vec(random_vec);
+            ParallelMergeSort(test_vec, num_threads, grain_size);
+            ASSERT_EQ(test_vec, sorted_vec)
+                << "Parallel merge sort failed with " << num_threads
+                << " threads and grain size " << grain_size << ".";
+        }
+    }
+}
+
+/** The parallel merge must keep equivalent items in their original order.
+ */
+TEST_F(RandomizedParallelSortingTest, MergeSortIsStable) {
+    std::vector<std::pair<int, int>> records;
+    for (int i = 0; i < (int)random_vec.size(); ++i)
+        records.push_back(std::make_pair(random_vec[i], i));
+    auto expected_records(records);
+    std::stable_sort(
+        expected_records.begin(), expected_records.end(),
+        [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+            return a.first < b.first;
+        });
+
+    ThreadPool pool(4);
+    ParallelMergeSort(
+        records.begin(), records.end(), pool, 16, Less(),
+        [](const std::pair<int, int> &record) { return record.first; });
+    EXPECT_EQ(records, expected_records)
+        << "Parallel merge sort did not keep equal keys in order!";
+}
+
+TEST_F(RandomizedParallelSortingTest, QuicksortCorrectlySortsRandomVector) {
+    for (int num_threads : {1, 2, 4, 7}) {
+        for (int grain_size : {1, 64, kDefaultParallelGrainSize}) {
+            auto test_vec(random_vec);
+            ParallelQuicksort(test_vec, num_threads, grain_size);
+            ASSERT_EQ(test_vec, sorted_vec)
+                << "Parallel quicksort failed with " << num_threads
+                << " threads and grain size " << grain_size << ".";
+        }
+    }
+}
+
+/** Inputs that defeat naive pivots, and all-equal keys, must sort quickly.
+ */
+TEST(ParallelSortingTest, QuicksortCorrectlySortsPatternedVectors) {
+    const int size = 100000;
+    std::vector<int> ascending(size);
+    for (int i = 0; i < size; ++i)
+        ascending[i] = i;
+    std::vector<int> descending(ascending.rbegin(), ascending.rend());
+    std::vector<int> constant(size, 7);
+
+    for (auto input : {ascending, descending, constant}) {
+        auto expected_vec(input);
+        std::sort(expected_vec.begin(), expected_vec.end());
+        ParallelQuicksort(input, 4, 256);
+        EXPECT_EQ(input, expected_vec)
+            << "Parallel quicksort failed on a patterned vector!";
+    }
+}
+
+/** The parallel partition keeps the contract of `QuicksortPartition`.
+ */
+TEST_F(RandomizedParallelSortingTest, PartitionSplitsAroundPivot) {
+    ThreadPool pool(4);
+    for (bool equality_check : {true, false}) {
+        auto test_vec(random_vec);
+        int pivot = test_vec.back();
+        auto split = ParallelQuicksortPartition(
+            test_vec.begin(), test_vec.end(), pool, 100, Less(), Identity(),
+            equality_check);
+
+        EXPECT_EQ(*split, pivot) << "Pivot was not put in place!";
+        for (auto item = test_vec.begin(); item != split; ++item)
+            ASSERT_TRUE(equality_check ? *item <= pivot : *item < pivot)
+                << "An item belongs right of the pivot!";
+        for (auto item = split + 1; item != test_vec.end(); ++item)
+            ASSERT_TRUE(equality_check ? *item > pivot : *item >= pivot)
+                << "An item belongs left of the pivot!";
+
+        std::sort(test_vec.begin(), test_vec.end());
+        EXPECT_EQ(test_vec, sorted_vec) << "Items were lost!";
+    }
+}
+
+TEST_F(RandomizedParallelSortingTest, CountingSortCorrectlySortsRandomVector) {
+    for (int num_threads : {1, 2, 4, 7}) {
+        for (int grain_size : {1, 64, kDefaultParallelGrainSize}) {
+            auto out_vec = ParallelCountingSort(
+                random_vec, -100, 100, num_threads, grain_size);
+            ASSERT_EQ(out_vec, sorted_vec)
+                << "Parallel counting sort failed with " << num_threads
+                << " threads and grain size " << grain_size << ".";
+        }
+    }
+}
+
+/** Each chunk's items with a key must land after the previous chunk's.
+ */
+TEST_F(RandomizedParallelSortingTest, CountingSortIsStable) {
+    std::vector<std::pair<int, int>> records;
+    for (int i = 0; i < (int)random_vec.size(); ++i)
+        records.push_back(std::make_pair(random_vec[i], i));
+    auto expected_records(records);
+    std::stable_sort(
+        expected_records.begin(), expected_records.end(),
+        [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+            return a.first < b.first;
+        });
+
+    ThreadPool pool(4);
+    std::vector<std::pair<int, int>> output(records.size());
+    ParallelCountingSort(
+        records.begin(), records.end(), output.begin(), -100, 100, pool, 16,
+        [](const std::pair<int, int> &record) { return record.first; });
+    EXPECT_EQ(output, expected_records)
+        << "Parallel counting sort did not keep equal keys in order!";
+}
@@ -0,0 +1,64 @@
+/** Benchmarks for `partial_sort.hpp`
+ *
+ * `argument()` is k, the number of items wanted (the median's index, for
+ * `NthElement`, is n / 2 whatever the argument).
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/vector/sort.hpp"
+
+
+namespace {
+
+const std::vector<int> kNumWanted = {10, 1000, 100000};
+
+/** Time an in-place call on a fresh copy of the input on every iteration.
+ */
+template <typename Function>
+void RunInPlaceBenchmark(BenchmarkState &state, Function function) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    std::vector<int> vec;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+        function(vec);
+    }
+}
+
+void BM_PartialSort(BenchmarkState &state) {
+    if (state.argument() > state.size()) {
+        state.SkipWithMessage("k is larger than the input");
+        return;
+    }
+    int k = state.argument();
+    RunInPlaceBenchmark(state, [k](std::vector<int> &vec) {
+        PartialSort(vec, k);
+    });
+}
+
+void BM_NthElement(BenchmarkState &state) {
+    RunInPlaceBenchmark(state, [](std::vector<int> &vec) {
+        NthElement(vec, (int)vec.size() / 2);
+    });
+}
+
+void BM_TopK(BenchmarkState &state) {
+    if (state.argument() > state.size()) {
+        state.SkipWithMessage("k is larger than the input");
+        return;
+    }
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    while (state.KeepRunning()) {
+        auto top = TopK(input, state.argument());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_PartialSort)->Arguments(kNumWanted);
+BENCHMARK(BM_NthElement);
+BENCHMARK(BM_TopK)->Arguments(kNumWanted);
@@ -0,0 +1,135 @@
+/** Unit tests for `partial_sort.hpp`
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/vector/partial_sort.hpp"
+#include "algorithm/vector/sort.hpp"
+
+
+namespace {
+
+/** Inputs of a few shapes, including ones with many equal items. */
+std::vector<std::vector<int>> PatternedVectors(const int size) {
+    std::vector<int> random(size);
+    RandomlyFillVector(random, -1000, 1000);
+    std::vector<int> few_unique(size);
+    RandomlyFillVector(few_unique, 0, 3);
+    std::vector<int> ascending(size);
+    for (int i = 0; i < size; ++i)
+        ascending[i] = i;
+    std::vector<int> descending(ascending.rbegin(), ascending.rend());
+    std::vector<int> constant(size, 7);
+    return {random, few_unique, ascending, descending, constant};
+}
+
+/** Check `vec` is partitioned around `vec[n]`, which is `sorted[n]`. */
+void ExpectNthElement(
+        const std::vector<int> &vec, const std::vector<int> &sorted,
+        const int n) {
+    ASSERT_EQ(vec[n], sorted[n]) << "Wrong item selected for index " << n;
+    for (int i = 0; i < n; ++i)
+        ASSERT_LE(vec[i], vec[n]) << "Item before the n-th is greater!";
+    for (int i = n + 1; i < (int)vec.size(); ++i)
+        ASSERT_GE(vec[i], vec[n]) << "Item after the n-th is smaller!";
+}
+
+} // namespace
+
+TEST(NthElementTest, SelectsEveryPosition) {
+    for (int size : {1, 2, 5, 17, 100, 1000}) {
+        for (const auto &input : PatternedVectors(size)) {
+            auto sorted(input);
+            std::sort(sorted.begin(), sorted.end());
+            for (int n = 0; n < size; n += std::max(1, size / 23)) {
+                auto vec(input);
+                NthElement(vec, n);
+                ExpectNthElement(vec, sorted, n);
+            }
+        }
+    }
+}
+
+/** Checks median of medians on its own (as if the random pivots all failed).
+ */
+TEST(NthElementTest, MedianOfMediansSelects) {
+    for (const auto &input : PatternedVectors(5000)) {
+        auto sorted(input);
+        std::sort(sorted.begin(), sorted.end());
+        for (int n : {0, 1, 2499, 2500, 4998, 4999}) {
+            auto vec(input);
+            Less comp;
+            Identity proj;
+            detail::SelectLoop(
+                vec.begin(), vec.begin() + n, vec.end(), 0, comp, proj);
+            ExpectNthElement(vec, sorted, n);
+        }
+    }
+}
+
+TEST(PartialSortTest, SortsSmallestItems) {
+    const int size = 2000;
+    for (const auto &input : PatternedVectors(size)) {
+        auto sorted(input);
+        std::sort(sorted.begin(), sorted.end());
+        // Both the heap (small k) and the selection (large k) strategies
+        for (int k : {0, 1, 10, 100, 125, 126, 1000, size}) {
+            auto vec(input);
+            PartialSort(vec, k);
+            EXPECT_TRUE(std::equal(vec.begin(), vec.begin() + k,
+                                   sorted.begin()))
+                << "Smallest " << k << " items were not sorted!";
+            std::sort(vec.begin() + k, vec.end());
+            EXPECT_EQ(vec, sorted) << "Partial sort lost items!";
+        }
+    }
+}
+
+TEST(PartialSortTest, UsesComparatorAndProjection) {
+    std::vector<std::string> words = {
+        "pear", "fig", "banana", "kiwi", "apple", "cherry", "plum"};
+    PartialSort(
+        words.begin(), words.begin() + 3, words.end(), Greater(),
+        [](const std::string &word) { return word.size(); });
+    EXPECT_EQ(words[0].size(), 6u);
+    EXPECT_EQ(words[1].size(), 6u);
+    EXPECT_EQ(words[2], "apple") << "Partial sort by length failed!";
+}
+
+TEST(TopKTest, KeepsLargestItems) {
+    for (const auto &input : PatternedVectors(1000)) {
+        auto sorted(input);
+        std::sort(sorted.begin(), sorted.end(), Greater());
+        for (int k : {0, 1, 7, 1000, 1500}) {
+            std::vector<int> expected_vec(
+                sorted.begin(),
+                sorted.begin() + std::min(k, (int)sorted.size()));
+            EXPECT_EQ(TopK(input, k), expected_vec)
+                << "Wrong top " << k << " items!";
+        }
+    }
+}
+
+TEST(TopKTest, StreamsItems) {
+    std::istringstream stream("5 1 9 3 9 7 2 8");
+    auto top = TopK(std::istream_iterator<int>(stream),
+                    std::istream_iterator<int>(), 3);
+    EXPECT_EQ(top, std::vector<int>({9, 9, 8}))
+        << "Wrong top items of a stream!";
+
+    // The smallest items, by keeping the "largest" under `Greater`
+    TopKHeap<int, Greater> bottom(2);
+    for (int item : {5, 1, 9, 3})
+        bottom.Push(item);
+    EXPECT_EQ(bottom.size(), 2u);
+    EXPECT_EQ(bottom.Min(), 3);
+    EXPECT_EQ(bottom.Sorted(), std::vector<int>({1, 3}))
+        << "Wrong bottom items!";
+}
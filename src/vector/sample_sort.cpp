@@ -0,0 +1,10 @@
+#include <vector>
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/vector/sample_sort.hpp"
+
+
+void SampleSort(std::vector<int> &vec, const int num_threads /*= 0*/) {
+    ThreadPool pool(num_threads);
+    SampleSort(vec.begin(), vec.end(), pool);
+}
@@ -0,0 +1,135 @@
+/** Unit tests for `sample_sort.cpp`
+ */
+
+#include <algorithm>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/parallel/thread_pool.hpp"
+#include "algorithm/vector/sample_sort.hpp"
+#include "algorithm/random.hpp"
+
+
+/** Randomized test fixture for sample sort.
+ */
+class RandomizedSampleSortTest: public ::testing::Test {
+public:
+    std::vector<int> random_vec;
+    std::vector<int> sorted_vec;
+
+protected:
+    virtual void SetUp() {
+        std::srand((unsigned int)std::time(nullptr)); // Seed the RNG
+
+        int random_size = RandomInteger(1000, 20000);
+        random_vec = std::vector<int>((unsigned int)random_size);
+        RandomlyFillVector(random_vec, -1000, 1000);
+
+        sorted_vec = random_vec;
+        std::sort(sorted_vec.begin(), sorted_vec.end());
+    }
+};
+
+TEST(SplitterTreeTest, ClassifiesKeysBetweenSplitters) {
+    std::vector<int> splitters = {10, 20, 30};
+    SplitterTree<int> tree(splitters);
+    ASSERT_EQ(tree.NumBuckets(), 4);
+
+    EXPECT_EQ(tree.Classify(-5), 0);
+    EXPECT_EQ(tree.Classify(10), 0) << "Keys equal to a splitter go left";
+    EXPECT_EQ(tree.Classify(11), 1);
+    EXPECT_EQ(tree.Classify(25), 2);
+    EXPECT_EQ(tree.Classify(30), 2);
+    EXPECT_EQ(tree.Classify(31), 3);
+}
+
+/** With fewer splitters than a power of two, the extra buckets stay empty.
+ */
+TEST(SplitterTreeTest, PadsToPowerOfTwoBuckets) {
+    std::vector<int> splitters = {10, 20, 30, 40, 50};
+    SplitterTree<int> tree(splitters);
+    ASSERT_EQ(tree.NumBuckets(), 8);
+
+    int previous_bucket = 0;
+    for (int key = 0; key <= 60; ++key) {
+        int bucket = tree.Classify(key);
+        EXPECT_GE(bucket, previous_bucket) << "Buckets must follow key order";
+        previous_bucket = bucket;
+    }
+    EXPECT_EQ(tree.Classify(50), 4);
+    EXPECT_EQ(tree.Classify(51), 7);
+}
+
+TEST_F(RandomizedSampleSortTest, ExchangeGroupsItemsByBucketStably) {
+    ThreadPool pool(3);
+    SharedMemoryBucketExchange exchange(pool);
+
+    std::vector<std::pair<int, int>> records;
+    for (int i = 0; i < (int)random_vec.size(); ++i)
+        records.push_back(std::make_pair(random_vec[i], i));
+    auto bucket = [](const std::pair<int, int> &record) {
+        return (record.first + 1000) / 500;
+    };
+
+    std::vector<std::pair<int, int>> output(records.size());
+    auto bucket_begin = exchange.Exchange(
+        records.begin(), records.end(), output.begin(), 5, bucket);
+    ASSERT_EQ(bucket_begin.size(), 6u);
+    EXPECT_EQ(bucket_begin.back(), records.size());
+    for (int b = 0; b < 5; ++b)
+        for (std::size_t i = bucket_begin[b]; i < bucket_begin[b + 1]; ++i) {
+            ASSERT_EQ(bucket(output[i]), b) << "Item is in the wrong bucket!";
+            if (i > bucket_begin[b]) {
+                ASSERT_LT(output[i - 1].second, output[i].second)
+                    << "Items of a bucket are out of their input order!";
+            }
+        }
+}
+
+TEST_F(RandomizedSampleSortTest, CorrectlySortsRandomVector) {
+    for (int num_threads : {1, 2, 4, 7}) {
+        ThreadPool pool(num_threads);
+        for (int grain_size : {1, kDefaultParallelGrainSize}) {
+            auto test_vec(random_vec);
+            SampleSort(test_vec.begin(), test_vec.end(), pool, grain_size);
+            ASSERT_EQ(test_vec, sorted_vec)
+                << "Sample sort failed with " << num_threads
+                << " threads and grain size " << grain_size << ".";
+        }
+    }
+
+    auto test_vec(random_vec);
+    SampleSort(test_vec);
+    EXPECT_EQ(test_vec, sorted_vec) << "Sample sort failed on all cores.";
+}
+
+/** Few distinct keys make many splitters equal, and buckets lopsided.
+ */
+TEST(SampleSortTest, CorrectlySortsManyDuplicates) {
+    std::vector<int> test_vec(50000);
+    RandomlyFillVector(test_vec, 0, 3);
+    auto expected_vec(test_vec);
+    std::sort(expected_vec.begin(), expected_vec.end());
+
+    ThreadPool pool(4);
+    SampleSort(test_vec.begin(), test_vec.end(), pool, 1);
+    EXPECT_EQ(test_vec, expected_vec) << "Sample sort failed on duplicates!";
+}
+
+TEST_F(RandomizedSampleSortTest, UsesComparatorAndProjection) {
+    std::vector<std::pair<int, int>> records;
+    for (int i = 0; i < (int)random_vec.size(); ++i)
+        records.push_back(std::make_pair(i, random_vec[i]));
+
+    ThreadPool pool(4);
+    SampleSort(
+        records.begin(), records.end(), pool, 1, Greater(),
+        [](const std::pair<int, int> &record) { return record.second; });
+    for (std::size_t i = 0; i < records.size(); ++i)
+        ASSERT_EQ(records[i].second, sorted_vec[sorted_vec.size() - 1 - i])
+            << "Records were not sorted by descending key!";
+}
@@ -0,0 +1,210 @@
+/** SIMD linear scan kernels (internal to the vectorized scan code).
+ *
+ * Written once against a small set of register operations (`Ops`), and
+ * instantiated by each instruction set's source file. An `Ops` class
+ * provides:
+ * - `Register`, the register type, `Mask`, the type of a comparison's
+ *   result, and `kLanes`, the ints per register;
+ * - `Load(const int *)` (unaligned), `Store(int *, Register)` (unaligned),
+ *   `Broadcast(int)`, `LaneIndices()` (lane i holding i) and `Add(a, b)`;
+ * - `Less(a, b)`, the lanes where `a` is less than `b`, and
+ *   `Select(mask, a, b)`, `a` in those lanes and `b` in the others;
+ * - `EqualBits(a, b)`, the lanes where `a` equals `b` as the low bits of an
+ *   int (bit i for lane i);
+ * - `AddWide(sums, items)`, which adds the items, sign-extended, to the
+ *   `kLanes / 2` 64-bit lanes of `sums`, and `StoreWide(long long *, sums)`.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_SCAN_KERNELS_HPP
+#define ALGORITHMS_STUDY_CPP_SCAN_KERNELS_HPP
+
+#include <cstdint>
+
+#include "algorithm/vector/vectorized_scan.hpp"
+
+
+namespace detail {
+
+const int *FindScalar(const int *first, const int *last, const int value);
+const int *MinElementScalar(const int *first, const int *last);
+const int *MaxElementScalar(const int *first, const int *last);
+ScanStatistics StatisticsScalar(const int *first, const int *last);
+
+/** Return the first int of `[first, last)` equal to `value`, or `last`.
+ *
+ * Four registers are compared per step, and their results merged into one
+ * bit mask, so there is one branch per `4 kLanes` ints.
+ */
+template <typename Ops>
+const int *ScanFind(const int *first, const int *last, const int value) {
+    const int kLanes = Ops::kLanes;
+    typename Ops::Register values = Ops::Broadcast(value);
+    for (; last - first >= 4 * kLanes; first += 4 * kLanes) {
+        std::uint64_t bits = 0;
+        for (int i = 0; i < 4; ++i)
+            bits |= (std::uint64_t)Ops::EqualBits(
+                Ops::Load(first + i * kLanes), values) << (i * kLanes);
+        if (bits != 0)
+            return first + __builtin_ctzll(bits);
+    }
+    for (; last - first >= kLanes; first += kLanes) {
+        unsigned int bits = Ops::EqualBits(Ops::Load(first), values);
+        if (bits != 0)
+            return first + __builtin_ctz(bits);
+    }
+    return FindScalar(first, last, value);
+}
+
+/** Return the lane with the smallest (or, if `max`, largest) int, and of
+ * those, the lowest index.
+ *
+ * Static, as it does not depend on `Ops`: each instruction set's source file
+ * gets its own copy, compiled for that instruction set, instead of the
+ * linker keeping any one of them.
+ */
+template <bool max>
+static int BestLane(
+        const int *lane_best, const int *lane_index, const int lanes) {
+    int result = 0;
+    for (int lane = 1; lane < lanes; ++lane) {
+        bool better = max
+            ? lane_best[result] < lane_best[lane]
+            : lane_best[lane] < lane_best[result];
+        bool tie = lane_best[lane] == lane_best[result] &&
+                   lane_index[lane] < lane_index[result];
+        if (better || tie)
+            result = lane;
+    }
+    return result;
+}
+
+/** Return the first smallest (or, if `max`, largest) int of `[first, last)`,
+ * which must hold fewer than 2^31 ints.
+ *
+ * Two pairs of registers keep each lane's best int and its index, so the
+ * two dependency chains overlap. A lane only takes a new int that is
+ * strictly better, so it keeps the first of its best ints; ties between
+ * lanes go to the lowest index.
+ */
+template <typename Ops, bool max>
+const int *ScanExtreme(const int *first, const int *last) {
+    typedef typename Ops::Register Register;
+    const int kLanes = Ops::kLanes;
+    if (last - first < 2 * kLanes)
+        return max
+            ? MaxElementScalar(first, last) : MinElementScalar(first, last);
+
+    Register step = Ops::Broadcast(2 * kLanes);
+    Register index[2] = {
+        Ops::LaneIndices(), Ops::Add(Ops::LaneIndices(),
+                                     Ops::Broadcast(kLanes))};
+    Register best[2] = {Ops::Load(first), Ops::Load(first + kLanes)};
+    Register best_index[2] = {index[0], index[1]};
+    const int *item = first + 2 * kLanes;
+    for (; last - item >= 2 * kLanes; item += 2 * kLanes) {
+        for (int i = 0; i < 2; ++i) {
+            index[i] = Ops::Add(index[i], step);
+            Register items = Ops::Load(item + i * kLanes);
+            typename Ops::Mask better = max
+                ? Ops::Less(best[i], items) : Ops::Less(items, best[i]);
+            best[i] = Ops::Select(better, items, best[i]);
+            best_index[i] = Ops::Select(better, index[i], best_index[i]);
+        }
+    }
+
+    int lane_best[2 * kLanes];
+    int lane_index[2 * kLanes];
+    for (int i = 0; i < 2; ++i) {
+        Ops::Store(lane_best + i * kLanes, best[i]);
+        Ops::Store(lane_index + i * kLanes, best_index[i]);
+    }
+    int result = BestLane<max>(lane_best, lane_index, 2 * kLanes);
+    // The rest come after every index in the lanes, so only a strictly
+    // better int replaces the lanes' best
+    const int *extreme = first + lane_index[result];
+    for (; item != last; ++item)
+        if (max ? *extreme < *item : *item < *extreme)
+            extreme = item;
+    return extreme;
+}
+
+/** Return the statistics of `[first, last)`, which must hold fewer than
+ * 2^31 ints.
+ *
+ * Like `ScanExtreme`, but with one register each for the lanes' smallest
+ * and largest ints and their indices, and one of 64-bit sums.
+ */
+template <typename Ops>
+ScanStatistics ScanSummary(const int *first, const int *last) {
+    typedef typename Ops::Register Register;
+    const int kLanes = Ops::kLanes;
+    if (last - first < kLanes)
+        return StatisticsScalar(first, last);
+
+    Register step = Ops::Broadcast(kLanes);
+    Register index = Ops::LaneIndices();
+    Register min = Ops::Load(first);
+    Register max = min;
+    Register min_index = index;
+    Register max_index = index;
+    Register sums = Ops::AddWide(Ops::Broadcast(0), min);
+    const int *item = first + kLanes;
+    for (; last - item >= kLanes; item += kLanes) {
+        index = Ops::Add(index, step);
+        Register items = Ops::Load(item);
+        typename Ops::Mask smaller = Ops::Less(items, min);
+        typename Ops::Mask larger = Ops::Less(max, items);
+        min = Ops::Select(smaller, items, min);
+        min_index = Ops::Select(smaller, index, min_index);
+        max = Ops::Select(larger, items, max);
+        max_index = Ops::Select(larger, index, max_index);
+        sums = Ops::AddWide(sums, items);
+    }
+
+    int lane_min[kLanes];
+    int lane_min_index[kLanes];
+    int lane_max[kLanes];
+    int lane_max_index[kLanes];
+    long long lane_sums[kLanes / 2];
+    Ops::Store(lane_min, min);
+    Ops::Store(lane_min_index, min_index);
+    Ops::Store(lane_max, max);
+    Ops::Store(lane_max_index, max_index);
+    Ops::StoreWide(lane_sums, sums);
+    int min_lane = BestLane<false>(lane_min, lane_min_index, kLanes);
+    int max_lane = BestLane<true>(lane_max, lane_max_index, kLanes);
+    ScanStatistics statistics;
+    statistics.min = lane_min[min_lane];
+    statistics.min_index = lane_min_index[min_lane];
+    statistics.max = lane_max[max_lane];
+    statistics.max_index = lane_max_index[max_lane];
+    statistics.sum = 0;
+    for (int lane = 0; lane < kLanes / 2; ++lane)
+        statistics.sum += lane_sums[lane];
+    statistics.count = last - first;
+    for (; item != last; ++item) {
+        if (*item < statistics.min) {
+            statistics.min = *item;
+            statistics.min_index = item - first;
+        }
+        if (statistics.max < *item) {
+            statistics.max = *item;
+            statistics.max_index = item - first;
+        }
+        statistics.sum += *item;
+    }
+    return statistics;
+}
+
+const int *FindAvx2(const int *first, const int *last, const int value);
+const int *MinElementAvx2(const int *first, const int *last);
+const int *MaxElementAvx2(const int *first, const int *last);
+ScanStatistics StatisticsAvx2(const int *first, const int *last);
+const int *FindAvx512(const int *first, const int *last, const int value);
+const int *MinElementAvx512(const int *first, const int *last);
+const int *MaxElementAvx512(const int *first, const int *last);
+ScanStatistics StatisticsAvx512(const int *first, const int *last);
+
+} // namespace detail
+
+#endif //ALGORITHMS_STUDY_CPP_SCAN_KERNELS_HPP
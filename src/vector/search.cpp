@@ -10,42 +10,36 @@
 
 
 int LinearSearch(const std::vector<int> &vec, const int value) {
-    for(int i = 0; i < vec.size(); i++)
-        if (vec[i] == value) return i;
-
-    throw std::runtime_error("Value not found!");
+    const int *first = vec.data();
+    const int *position = VectorizedFind(first, first + vec.size(), value);
+    return position == first + vec.size() ? kNotFound : position - first;
 }
 
 int MinIndex(const std::vector<int> &vec, const int begin_index /*= 0*/) {
-    assert(begin_index < vec.size() &&
+    assert(begin_index < (int)vec.size() &&
         "Cannot begin search at index larger than size of vector!");
-
-    int min_index = begin_index;
-
-    int search_index = begin_index + 1;
-    while (search_index < vec.size()) {
-        if (vec[search_index] < vec[min_index])
-            min_index = search_index;
-
-        search_index++;
-    }
-    return min_index;
+    const int *first = vec.data();
+    return VectorizedMinElement(first + begin_index, first + vec.size()) -
+           first;
 }
 
 int MaxIndex(const std::vector<int> &vec, const int begin_index /*= 0*/) {
-    assert(begin_index < vec.size() &&
+    assert(begin_index < (int)vec.size() &&
         "Cannot begin search at index larger than size of vector!");
+    const int *first = vec.data();
+    return VectorizedMaxElement(first + begin_index, first + vec.size()) -
+           first;
+}
 
-    int max_index = begin_index;
-
-    int search_index = begin_index + 1;
-    while (search_index < vec.size()) {
-        if (vec[search_index] > vec[max_index])
-            max_index = search_index;
-
-        search_index++;
-    }
-    return max_index;
+std::tuple<int, int> MinMaxIndex(
+        const std::vector<int> &vec, const int begin_index /*= 0*/) {
+    assert(begin_index < (int)vec.size() &&
+        "Cannot begin search at index larger than size of vector!");
+    const int *first = vec.data();
+    ScanStatistics statistics =
+        VectorizedStatistics(first + begin_index, first + vec.size());
+    return std::make_tuple(begin_index + (int)statistics.min_index,
+                           begin_index + (int)statistics.max_index);
 }
 
 int RelativeMaxIndex(const std::vector<int> &vec, const int begin_index) {
@@ -64,28 +58,84 @@ int RelativeMaxIndex(const std::vector<int> &vec, const int begin_index) {
     return vec.size() - 1;
 };
 
+int Select(std::vector<int> &vec, const int i) {
+    assert(i >= 0 && i < (int)vec.size() && "Order statistic out of range!");
+    NthElement(vec.begin(), vec.begin() + i, vec.end());
+    return vec[i];
+}
+
+int RandomizedSelect(std::vector<int> &vec, const int i) {
+    assert(i >= 0 && i < (int)vec.size() && "Order statistic out of range!");
+    return *RandomizedSelect(vec.begin(), vec.begin() + i, vec.end());
+}
+
+int DeterministicSelect(std::vector<int> &vec, const int i) {
+    assert(i >= 0 && i < (int)vec.size() && "Order statistic out of range!");
+    return *DeterministicSelect(vec.begin(), vec.begin() + i, vec.end());
+}
+
+int FloydRivestSelect(std::vector<int> &vec, const int i) {
+    assert(i >= 0 && i < (int)vec.size() && "Order statistic out of range!");
+    return *FloydRivestSelect(vec.begin(), vec.begin() + i, vec.end());
+}
+
+std::vector<int> Quantiles(
+        std::vector<int> &vec, const std::vector<double> &quantiles) {
+    assert(!vec.empty() && "Cannot take quantiles of an empty vector!");
+    std::vector<int> ranks;
+    for (double quantile : quantiles) {
+        assert(quantile >= 0 && quantile <= 1 && "Quantile out of range!");
+        ranks.push_back((int)std::floor(quantile * (vec.size() - 1)));
+    }
+    std::vector<int> sorted_ranks(ranks);
+    std::sort(sorted_ranks.begin(), sorted_ranks.end());
+    MultiSelect(
+        vec.begin(), vec.end(), sorted_ranks.begin(), sorted_ranks.end());
+
+    std::vector<int> items;
+    for (int rank : ranks)
+        items.push_back(vec[rank]);
+    return items;
+}
+
 int BinarySearch(
         const std::vector<int> &vec, const int begin_index, const int end_index,
         const int value) {
+    auto position = LowerBound(
+        vec.begin() + begin_index, vec.begin() + end_index, value);
+    if (position == vec.begin() + end_index || *position != value)
+        throw std::runtime_error("Value not found!");
+    return position - vec.begin();
+}
 
-    int middle_index = static_cast<int>(
-        std::floor((begin_index + end_index)/2.));
+int LowerBound(const std::vector<int> &vec, const int value) {
+    return LowerBound(vec.begin(), vec.end(), value) - vec.begin();
+}
 
-    if (end_index - begin_index > 1) {
-        if (value < vec[middle_index])
-            BinarySearch(vec, begin_index, middle_index, value);
-        else
-            BinarySearch(vec, middle_index, end_index, value);
-    }
-    else if (vec[middle_index] == value)
-        return middle_index;
-    else
-        throw std::runtime_error("Value not found!");
+int UpperBound(const std::vector<int> &vec, const int value) {
+    return UpperBound(vec.begin(), vec.end(), value) - vec.begin();
+}
+
+std::tuple<int, int> EqualRange(const std::vector<int> &vec, const int value) {
+    auto range = EqualRange(vec.begin(), vec.end(), value);
+    return std::make_tuple(
+        range.first - vec.begin(), range.second - vec.begin());
+}
+
+std::vector<int> BatchedLowerBound(
+        const std::vector<int> &vec, const std::vector<int> &values) {
+    std::vector<std::vector<int>::const_iterator> positions(values.size());
+    BatchedLowerBound(vec.begin(), vec.end(), values.begin(), values.end(),
+                      positions.begin());
+    std::vector<int> indices(values.size());
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        indices[i] = positions[i] - vec.begin();
+    return indices;
 }
 
 // TODO I should change this to std::map<std::str, int> instead of tuple
 std::tuple<int, int, int> FindMaxCrossingSubvector(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int middle_index,
         const int end_index) {
@@ -131,7 +181,7 @@ std::tuple<int, int, int> FindMaxCrossingSubvector(
 // TODO I don't really want to do this now, so I'm going to the modify
 // TODO the tests that are failing so they only check the max sum.
 std::tuple<int, int, int> FindMaxSubvectorDAC(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int end_index) {
     // Base case; return the only entry
@@ -164,7 +214,7 @@ std::tuple<int, int, int> FindMaxSubvectorDAC(
 }
 
 std::tuple<int, int, int> FindMaxSubvectorBF(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int end_index) {
     int max_left_index;
@@ -187,7 +237,7 @@ std::tuple<int, int, int> FindMaxSubvectorBF(
 }
 
 std::tuple<int, int, int> FindMaxSubvector(
-        const std::vector<int> vec,
+        const std::vector<int> &vec,
         const int begin_index,
         const int end_index) {
     int overall_max = vec[begin_index];
@@ -197,7 +247,7 @@ std::tuple<int, int, int> FindMaxSubvector(
     int overall_max_right_index = begin_index + 1;
     int max_ending_here_left_index = begin_index;
 
-    for (int index = 1; index < end_index; ++index) {
+    for (int index = begin_index + 1; index < end_index; ++index) {
         if (max_ending_here > 0)
             // If the previous max ending here is positive, the max ending
             // at the next index will be increased by adding it...
@@ -217,3 +267,18 @@ std::tuple<int, int, int> FindMaxSubvector(
     return std::make_tuple(
         overall_max_left_index, overall_max_right_index, overall_max);
 }
+
+std::tuple<int, int, long long> ParallelFindMaxSubvector(
+        const std::vector<int> &vec,
+        const int begin_index,
+        const int end_index,
+        const int num_threads /*= 0*/,
+        const int grain_size /*= kMaxSubarrayGrainSize*/) {
+    assert(end_index > begin_index &&
+        "Cannot search an empty range for a subvector!");
+    ThreadPool pool(num_threads);
+    auto summary = ParallelSummarizeSubarrays(
+        vec.begin() + begin_index, vec.begin() + end_index, pool, grain_size);
+    return std::make_tuple(begin_index + (int)summary.best_begin,
+                           begin_index + (int)summary.best_end, summary.best);
+}
@@ -90,6 +90,25 @@ TEST_F(GeneralSearchingTest, MaxMinSearchFindsCorrectItems) {
         << "Maximum index function disagrees with expected index.";
 }
 
+/** The fused min/max searches should agree with the separate ones.
+ */
+TEST_F(GeneralSearchingTest, MinMaxSearchFindsCorrectItems) {
+    EXPECT_EQ(MinMaxIndex(vec), std::make_tuple(7, 9))
+        << "Min/max index function disagrees with expected indices.";
+    EXPECT_EQ(MinMaxIndex(vec, 8), std::make_tuple(10, 9))
+        << "Min/max index function disagrees with expected indices.";
+
+    // Generic version: the first minimum and the last maximum
+    std::vector<int> ties = {3, 1, 4, 1, 5, 9, 2, 6, 5, 9};
+    auto extremes = MinMaxElement(ties.begin(), ties.end());
+    EXPECT_EQ(extremes.first - ties.begin(), 1);
+    EXPECT_EQ(extremes.second - ties.begin(), 9);
+    extremes = MinMaxElement(
+        ties.begin(), ties.end(), Less(), [](int x) { return -x; });
+    EXPECT_EQ(extremes.first - ties.begin(), 5);
+    EXPECT_EQ(extremes.second - ties.begin(), 3);
+}
+
 /** Basic test of vector relative max index search.
  */
 TEST_F(GeneralSearchingTest, RelativeMaxSearchFindsCorrectItem) {
@@ -99,11 +118,18 @@ TEST_F(GeneralSearchingTest, RelativeMaxSearchFindsCorrectItem) {
         << "Relative maximum index function disagrees with expected index.";
 }
 
-/** Item search algorithms should throw exception if item not found.
+/** Linear search should return the sentinel if item not found.
  */
-TEST_F(GeneralSearchingTest, ItemNotFoundThrowsException) {
-    EXPECT_THROW(LinearSearch(vec, 20), std::runtime_error);
+TEST_F(GeneralSearchingTest, ItemNotFoundReturnsSentinel) {
+    EXPECT_EQ(LinearSearch(vec, 20), kNotFound)
+        << "Linear search did not return kNotFound for a missing item.";
+    EXPECT_EQ(LinearSearch(std::vector<int>(), 2), kNotFound)
+        << "Linear search of an empty vector found an item.";
+}
 
+/** Binary search should throw exception if item not found.
+ */
+TEST_F(GeneralSearchingTest, ItemNotFoundThrowsException) {
     // To test binary search, we first sort the vector
     InsertionSort(vec);
     EXPECT_THROW(BinarySearch(vec, 0, vec.size(), 20), std::runtime_error);
@@ -0,0 +1,73 @@
+/** Benchmarks for `select.hpp`
+ *
+ * The single selections find the median. The percentile benchmarks find
+ * p50, p90, p99 and p99.9 of the input, as a monitoring dashboard would of
+ * each window of samples.
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/vector/search.hpp"
+#include "algorithm/vector/select.hpp"
+
+
+namespace {
+
+const std::vector<double> kPercentiles = {0.5, 0.9, 0.99, 0.999};
+
+/** Time an in-place call on a fresh copy of the input on every iteration.
+ */
+template <typename Function>
+void RunInPlaceBenchmark(BenchmarkState &state, Function function) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    std::vector<int> vec;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+        function(vec);
+    }
+}
+
+void BM_RandomizedSelect(BenchmarkState &state) {
+    RunInPlaceBenchmark(state, [](std::vector<int> &vec) {
+        RandomizedSelect(vec, (int)vec.size() / 2);
+    });
+}
+
+void BM_DeterministicSelect(BenchmarkState &state) {
+    RunInPlaceBenchmark(state, [](std::vector<int> &vec) {
+        DeterministicSelect(vec, (int)vec.size() / 2);
+    });
+}
+
+void BM_FloydRivestSelect(BenchmarkState &state) {
+    RunInPlaceBenchmark(state, [](std::vector<int> &vec) {
+        FloydRivestSelect(vec, (int)vec.size() / 2);
+    });
+}
+
+/** One `Select` per percentile, each on the whole vector. */
+void BM_RepeatedSelectPercentiles(BenchmarkState &state) {
+    RunInPlaceBenchmark(state, [](std::vector<int> &vec) {
+        for (double percentile : kPercentiles)
+            Select(vec, (int)(percentile * (vec.size() - 1)));
+    });
+}
+
+/** All the percentiles in one `MultiSelect` pass. */
+void BM_QuantilesPercentiles(BenchmarkState &state) {
+    RunInPlaceBenchmark(state, [](std::vector<int> &vec) {
+        Quantiles(vec, kPercentiles);
+    });
+}
+
+} // namespace
+
+BENCHMARK(BM_RandomizedSelect);
+BENCHMARK(BM_DeterministicSelect);
+BENCHMARK(BM_FloydRivestSelect);
+BENCHMARK(BM_RepeatedSelectPercentiles);
+BENCHMARK(BM_QuantilesPercentiles);
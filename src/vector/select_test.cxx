@@ -0,0 +1,102 @@
+/** Unit tests for `select.hpp`
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/vector/search.hpp"
+#include "algorithm/vector/select.hpp"
+
+
+namespace {
+
+/** Inputs of a few shapes, including ones with many equal items. */
+std::vector<std::vector<int>> PatternedVectors(const int size) {
+    std::vector<int> random(size);
+    RandomlyFillVector(random, -1000, 1000);
+    std::vector<int> few_unique(size);
+    RandomlyFillVector(few_unique, 0, 3);
+    std::vector<int> ascending(size);
+    for (int i = 0; i < size; ++i)
+        ascending[i] = i;
+    std::vector<int> descending(ascending.rbegin(), ascending.rend());
+    std::vector<int> constant(size, 7);
+    return {random, few_unique, ascending, descending, constant};
+}
+
+/** Check `vec` is partitioned around `vec[n]`, which is `sorted[n]`. */
+void ExpectSelected(
+        const std::vector<int> &vec, const std::vector<int> &sorted,
+        const int n) {
+    ASSERT_EQ(vec[n], sorted[n]) << "Wrong item selected for index " << n;
+    for (int i = 0; i < n; ++i)
+        ASSERT_LE(vec[i], vec[n]) << "Item before the n-th is greater!";
+    for (int i = n + 1; i < (int)vec.size(); ++i)
+        ASSERT_GE(vec[i], vec[n]) << "Item after the n-th is smaller!";
+}
+
+} // namespace
+
+TEST(SelectTest, EveryAlgorithmSelectsEveryPosition) {
+    typedef int (*SelectFunction)(std::vector<int> &, const int);
+    const std::vector<SelectFunction> functions = {
+        Select, RandomizedSelect, DeterministicSelect, FloydRivestSelect};
+    // Sizes past `kFloydRivestSampleCutoff` exercise its sampling
+    for (int size : {1, 2, 5, 17, 100, 5000}) {
+        for (const auto &input : PatternedVectors(size)) {
+            auto sorted(input);
+            std::sort(sorted.begin(), sorted.end());
+            for (int n = 0; n < size; n += std::max(1, size / 23)) {
+                for (auto function : functions) {
+                    auto vec(input);
+                    EXPECT_EQ(function(vec, n), sorted[n]);
+                    ExpectSelected(vec, sorted, n);
+                }
+            }
+        }
+    }
+}
+
+TEST(SelectTest, UsesComparatorAndProjection) {
+    std::vector<std::string> words = {
+        "pear", "fig", "banana", "kiwi", "apple", "cherry", "plum"};
+    auto by_length = [](const std::string &word) { return word.size(); };
+    auto vec(words);
+    EXPECT_EQ(FloydRivestSelect(vec.begin(), vec.begin(), vec.end(),
+                                Greater(), by_length)->size(), 6u);
+    vec = words;
+    EXPECT_EQ(*DeterministicSelect(vec.begin(), vec.begin(), vec.end(),
+                                   Less(), by_length), "fig");
+}
+
+TEST(MultiSelectTest, SelectsEveryRank) {
+    for (int size : {1, 17, 100, 10000}) {
+        for (const auto &input : PatternedVectors(size)) {
+            auto sorted(input);
+            std::sort(sorted.begin(), sorted.end());
+            // Repeated ranks, and ranks at both ends
+            std::vector<int> ranks = {0, size / 3, size / 3, size / 2,
+                                      size - 1 - size / 10, size - 1};
+            auto vec(input);
+            MultiSelect(vec.begin(), vec.end(), ranks.begin(), ranks.end());
+            for (int rank : ranks)
+                ExpectSelected(vec, sorted, rank);
+        }
+    }
+}
+
+TEST(MultiSelectTest, QuantilesOfIntVector) {
+    std::vector<int> vec(1001);
+    RandomlyFillVector(vec, -1000000, 1000000);
+    auto sorted(vec);
+    std::sort(sorted.begin(), sorted.end());
+    auto quantiles = Quantiles(vec, {0.99, 0.5, 0.0, 0.999, 1.0, 0.9});
+    EXPECT_EQ(quantiles, std::vector<int>({sorted[990], sorted[500], sorted[0],
+                                           sorted[999], sorted[1000],
+                                           sorted[900]}))
+        << "Wrong quantiles!";
+}
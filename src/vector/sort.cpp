@@ -1,216 +1,211 @@
-#include <iostream>
+#include <cstddef>
+#include <stdexcept>
 #include <vector>
-#include <limits>
-#include <cmath>
-#include <utility>
+#include <tuple>
 
-#include "algorithm/vector/search.hpp"
 #include "algorithm/vector/sort.hpp"
-#include "algorithm/vector/heap.hpp"
-#include "algorithm/random.hpp"
+#include "algorithm/vector/vectorized_scan.hpp"
 
 void InsertIntoSortedSubvector(
         std::vector<int> &vec, const int index,
         const bool ascending /*= true*/) {
-    int value_to_be_inserted = vec[index];
-
-    // We compare the index to each item before it in the vector
-    int search_index = index - 1;
-    while(search_index >= 0 &&
-            (ascending == (value_to_be_inserted < vec[search_index]))) {
-        vec[search_index + 1] = vec[search_index];
-        --search_index;
-    }
-    vec[search_index + 1] = value_to_be_inserted;
+    if (ascending)
+        InsertIntoSortedSubvector(vec.begin(), vec.begin() + index, Less());
+    else
+        InsertIntoSortedSubvector(vec.begin(), vec.begin() + index, Greater());
 }
 
 void InsertionSort(std::vector<int> &vec, const bool ascending /*= true*/) {
-    for(int key_index = 1; key_index < vec.size(); ++key_index) {
-        InsertIntoSortedSubvector(vec, key_index, ascending);
-    }
+    if (ascending)
+        InsertionSort(vec.begin(), vec.end(), Less());
+    else
+        InsertionSort(vec.begin(), vec.end(), Greater());
 }
 
 void InsertionSortRecursive(std::vector<int> &vec, const int subvector_size) {
-    if (subvector_size > 1)
-        InsertionSortRecursive(vec, subvector_size - 1);
-
-    InsertIntoSortedSubvector(vec, subvector_size - 1);
+    InsertionSortRecursive(vec.begin(), vec.begin() + subvector_size);
 }
 
 void SelectionSort(std::vector<int> &vec) {
-    for (int index = 0; index < vec.size() - 1; ++index) {
-        int min_index = MinIndex(vec, index);
-        if (min_index != index) {
-            // Swap the two values
-            int temp = vec[min_index];
-            vec[min_index] = vec[index];
-            vec[index] = temp;
-        }
-    }
+    SelectionSort(vec.begin(), vec.end());
 }
 
 void MergeSortedSubvectors(
         std::vector<int> &vec, const int begin_index, const int middle_index,
         const int end_index) {
-    // Extract the subvectors
-    std::vector<int> subvec1(
-        vec.begin() + begin_index, vec.begin() + middle_index);
-    std::vector<int> subvec2(
-        vec.begin() + middle_index, vec.begin() + end_index);
-
-    // Add the sentinels (largest possible integer is used)
-    subvec1.push_back(std::numeric_limits<int>::max());
-    subvec2.push_back(std::numeric_limits<int>::max());
-
-    int subvec1_index = 0;
-    int subvec2_index = 0;
-
-    for (int main_index = begin_index; main_index < end_index; ++main_index) {
-        if (subvec1[subvec1_index] <= subvec2[subvec2_index]) {
-            vec[main_index] = subvec1[subvec1_index];
-            ++subvec1_index;
-        }
-        else {
-            vec[main_index] = subvec2[subvec2_index];
-            ++subvec2_index;
-        }
-    }
+    MergeSortedSubvectors(
+        vec.begin() + begin_index, vec.begin() + middle_index,
+        vec.begin() + end_index);
 }
 
 void MergeSort(
         std::vector<int> &vec, const int begin_index, const int end_index) {
-    if (begin_index < end_index - 1) {
-        int middle_index = static_cast<int>(
-            std::floor((begin_index + end_index)/2.));
+    MergeSort(vec.begin() + begin_index, vec.begin() + end_index);
+}
+
+void BufferedMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index) {
+    BufferedMergeSort(vec.begin() + begin_index, vec.begin() + end_index);
+}
+
+void BufferedMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index,
+        std::vector<int> &scratch) {
+    if (scratch.size() < (std::size_t)(end_index - begin_index))
+        scratch.resize(end_index - begin_index);
+    MergeSortWithBuffer(
+        vec.begin() + begin_index, vec.begin() + end_index, scratch.begin());
+}
+
+void MultiwayMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index) {
+    MultiwayMergeSort(vec.begin() + begin_index, vec.begin() + end_index);
+}
 
-        MergeSort(vec, begin_index, middle_index);
-        MergeSort(vec, middle_index, end_index);
-        MergeSortedSubvectors(vec, begin_index, middle_index, end_index);
-    }
+void AdaptiveMergeSort(
+        std::vector<int> &vec, const int begin_index, const int end_index) {
+    AdaptiveMergeSort(vec.begin() + begin_index, vec.begin() + end_index);
 }
 
 void HeapSort(std::vector<int> &vec) {
-    MaxHeapBuilder(vec);
-    int heap_order = vec.size();
-    for (int i = vec.size() - 1; i >= 1; i--) {
-        std::swap(vec[0], vec[i]);
-        --heap_order;
-        MaxHeapify(vec, 0, heap_order);
-    }
+    HeapSort(vec.begin(), vec.end());
 }
 
 int QuicksortPartition(
+        std::vector<int> &vec, const int begin, const int end,
+        const bool equality_check /*= true*/,
+        const PartitionScheme scheme /*= PartitionScheme::kLomuto*/) {
+    return QuicksortPartition(
+        vec.begin() + begin, vec.begin() + end, Less(), Identity(),
+        equality_check, scheme) - vec.begin();
+}
+
+int VectorizedQuicksortPartition(
         std::vector<int> &vec, const int begin, const int end,
         const bool equality_check /*= true*/) {
-    auto pivot = vec[end - 1];
-    int left = begin - 1;
-    for (int right = begin; right < end - 1; ++right)
-        if (vec[right] < pivot || (equality_check && vec[right] == pivot)) {
-            ++left;
-            std::swap(vec[left], vec[right]);
-        }
-    std::swap(vec[left + 1], vec[end - 1]);
-    return left + 1;
+    return VectorizedQuicksortPartition(
+        vec.begin() + begin, vec.begin() + end, Less(), Identity(),
+        equality_check) - vec.begin();
 }
 
 std::tuple<int, int> EqCheckQuicksortPartition(
         std::vector<int> &vec, const int begin, const int end) {
-    int pivot_end = QuicksortPartition(vec, begin, end) + 1;
-    int pivot_begin = QuicksortPartition(vec, begin, pivot_end, false);
-    return std::make_tuple(pivot_begin, pivot_end);
+    auto pivot = EqCheckQuicksortPartition(
+        vec.begin() + begin, vec.begin() + end);
+    return std::make_tuple(
+        pivot.first - vec.begin(), pivot.second - vec.begin());
+}
+
+std::tuple<int, int> ThreeWayQuicksortPartition(
+        std::vector<int> &vec, const int begin, const int end) {
+    auto pivot = ThreeWayQuicksortPartition(
+        vec.begin() + begin, vec.begin() + end);
+    return std::make_tuple(
+        pivot.first - vec.begin(), pivot.second - vec.begin());
 }
 
 int RandomizedQuicksortPartition(
         std::vector<int> &vec, const int begin, const int end) {
-    int pivot = RandomInteger(begin, end - 1);
-    std::swap(vec[end - 1], vec[pivot]);
-    return QuicksortPartition(vec, begin, end);
+    return RandomizedQuicksortPartition(
+        vec.begin() + begin, vec.begin() + end) - vec.begin();
 }
 
 std::tuple<int, int> RandomizedEqCheckQuicksortPartition(
         std::vector<int> &vec, const int begin, const int end) {
-    int pivot = RandomInteger(begin, end - 1);
-    std::swap(vec[end - 1], vec[pivot]);
-    return EqCheckQuicksortPartition(vec, begin, end);
+    auto pivot = RandomizedEqCheckQuicksortPartition(
+        vec.begin() + begin, vec.begin() + end);
+    return std::make_tuple(
+        pivot.first - vec.begin(), pivot.second - vec.begin());
 }
 
 int HoareQuicksortPartition(
         std::vector<int> &vec, const int begin, const int end) {
-    auto pivot = vec[begin];
-    int left = begin - 1;
-    int right = end;
-    while (true) {
-        do {
-        --right;
-        } while (vec[right] > pivot);
-        do {
-        ++left;
-        } while (vec[left] < pivot);
-
-        if (left < right) std::swap(vec[left], vec[right]);
-        else return right;
-    }
-}
-
-void Quicksort(std::vector<int> &vec, const int begin, const int end) {
-    // Terminate recursion if subvector is singleton
-    if (1 < end - begin) {
-        int pivot = QuicksortPartition(vec, begin, end);
-        Quicksort(vec, begin, pivot);
-        Quicksort(vec, pivot + 1, end);
-    }
+    return HoareQuicksortPartition(
+        vec.begin() + begin, vec.begin() + end) - vec.begin();
+}
+
+void Quicksort(
+        std::vector<int> &vec, const int begin, const int end,
+        const PartitionScheme scheme /*= PartitionScheme::kLomuto*/) {
+    Quicksort(vec.begin() + begin, vec.begin() + end, Less(), Identity(),
+              scheme);
 }
 
 void RandomizedQuicksort(
-        std::vector<int> &vec, const int begin, const int end) {
-    // Terminate recursion if subvector is singleton
-    if (1 < end - begin) {
-        int pivot = RandomizedQuicksortPartition(vec, begin, end);
-        RandomizedQuicksort(vec, begin, pivot);
-        RandomizedQuicksort(vec, pivot + 1, end);
-    }
+        std::vector<int> &vec, const int begin, const int end,
+        const PartitionScheme scheme /*= PartitionScheme::kLomuto*/) {
+    RandomizedQuicksort(
+        vec.begin() + begin, vec.begin() + end, Less(), Identity(), scheme);
 }
 
 void RandomizedEqCheckQuicksort(
-        std::vector<int> &vec, const int begin, const int end) {
-    // Terminate recursion if subvector is singleton
-    if (1 < end - begin) {
-        auto pivot = RandomizedEqCheckQuicksortPartition(vec, begin, end);
-        RandomizedQuicksort(vec, begin, std::get<0>(pivot));
-        RandomizedQuicksort(vec, std::get<1>(pivot), end);
-    }
+        std::vector<int> &vec, const int begin, const int end,
+        const PartitionScheme scheme /*= PartitionScheme::kLomuto*/) {
+    RandomizedEqCheckQuicksort(
+        vec.begin() + begin, vec.begin() + end, Less(), Identity(), scheme);
 }
 
 void HoareQuicksort(std::vector<int> &vec, const int begin, const int end) {
-    // Terminate recursion if subvector is singleton
-    if (1 < end - begin) {
-        int pivot = HoareQuicksortPartition(vec, begin, end);
-        HoareQuicksort(vec, begin, pivot + 1);
-        HoareQuicksort(vec, pivot + 1, end);
-    }
+    HoareQuicksort(vec.begin() + begin, vec.begin() + end);
+}
+
+void IntroSort(std::vector<int> &vec, const int begin, const int end) {
+    IntroSort(vec.begin() + begin, vec.begin() + end);
+}
+
+void ThreeWayQuicksort(std::vector<int> &vec, const int begin, const int end) {
+    ThreeWayQuicksort(vec.begin() + begin, vec.begin() + end);
 }
 
 std::vector<int> CountingSort(
         std::vector<int> &input_vec, const int min, const int max) {
-    auto possible_values = max - min + 1;
-    std::vector<int> value_counts(possible_values, 0);
-
-    // This vector contains the counts of each value in the input vector
-    // It is zero-indexed; the item in index 0 is the number of times the min
-    // value shows up in the input vector, the item in index 1 is the number of
-    // times the min + 1 shows up, and so on up to the max value
-    for (int i = 0; i < input_vec.size(); ++i)
-        ++value_counts[input_vec[i] - min];
+    std::vector<int> output_vec(input_vec.size());
+    CountingSort(
+        input_vec.begin(), input_vec.end(), output_vec.begin(), min, max);
+    return output_vec;
+}
 
-    // This causes the vector to contain the number of entries that have value
-    // less than or equal to this value
-    for (int value_index = 1; value_index < possible_values; ++value_index)
-        value_counts[value_index] += value_counts[value_index - 1];
+std::vector<int> CountingSort(std::vector<int> &input_vec) {
+    if (input_vec.empty())
+        return std::vector<int>();
+    const int *first = input_vec.data();
+    ScanStatistics statistics =
+        VectorizedStatistics(first, first + input_vec.size());
+    if (detail::IsCountingSortRange(
+            statistics.min, statistics.max, input_vec.size()))
+        return CountingSort(input_vec, statistics.min, statistics.max);
 
-    std::vector<int> output_vec(input_vec.size());
-    for (int j = (int)input_vec.size() - 1; j >= 0; --j) {
-        output_vec[value_counts[input_vec[j] - min] - 1] = input_vec[j];
-        --value_counts[input_vec[j] - min];
-    }
+    std::vector<int> output_vec(input_vec);
+    LsdRadixSort(output_vec.begin(), output_vec.end());
     return output_vec;
 }
+
+void LsdRadixSort(std::vector<int> &vec) {
+    LsdRadixSort(vec.begin(), vec.end());
+}
+
+void AmericanFlagSort(std::vector<int> &vec) {
+    AmericanFlagSort(vec.begin(), vec.end());
+}
+
+void PartialSort(std::vector<int> &vec, const int k) {
+    PartialSort(vec.begin(), vec.begin() + k, vec.end());
+}
+
+void NthElement(std::vector<int> &vec, const int n) {
+    NthElement(vec.begin(), vec.begin() + n, vec.end());
+}
+
+std::vector<int> TopK(const std::vector<int> &vec, const int k) {
+    return TopK(vec.begin(), vec.end(), (std::size_t)k);
+}
+
+std::vector<int> ArgSort(const std::vector<int> &vec) {
+    return RadixArgSort<int>(vec.begin(), vec.end());
+}
+
+void SortByKey(std::vector<int> &keys, std::vector<int> &values) {
+    if (keys.size() != values.size())
+        throw std::runtime_error("Keys and values differ in length!");
+    RadixSortByKey(keys.begin(), keys.end(), values.begin());
+}
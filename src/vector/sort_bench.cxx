@@ -0,0 +1,224 @@
+/** Benchmarks for `sort.cpp`
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/vector/sort.hpp"
+
+
+namespace {
+
+/** Largest input a quadratic-time case is allowed to run on. */
+const int kMaxQuadraticSize = 10000;
+
+/** Skip the run if it is a known quadratic case for this algorithm.
+ *
+ * The textbook quicksorts degrade to Theta(n^2) time (and n-deep recursion,
+ * which overflows the stack) on some distributions; only small sizes of those
+ * are worth timing.
+ *
+ * @param state         State of the run.
+ * @param quadratic     Distributions this algorithm goes quadratic on.
+ * @return              True if the run was skipped.
+ */
+bool SkipIfQuadratic(
+        BenchmarkState &state,
+        const std::vector<InputDistribution> &quadratic) {
+    if (state.size() > kMaxQuadraticSize &&
+            std::find(quadratic.begin(), quadratic.end(),
+                      state.distribution()) != quadratic.end()) {
+        state.SkipWithMessage("quadratic on this distribution");
+        return true;
+    }
+    return false;
+}
+
+/** Time an in-place sort of a fresh copy of the input on every iteration.
+ */
+template <typename SortFunction>
+void RunSortBenchmark(BenchmarkState &state, SortFunction sort) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    std::vector<int> vec;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+        sort(vec);
+    }
+}
+
+// Input shapes with long runs of equal keys, where the quicksorts that put
+// equal items on one side of the pivot recurse once per duplicate.
+const std::vector<InputDistribution> kManyDuplicates = {
+    InputDistribution::kFewUnique, InputDistribution::kSawtooth};
+
+// Input shapes where a first- or last-item pivot is (nearly) the extreme value.
+const std::vector<InputDistribution> kPresorted = {
+    InputDistribution::kSorted, InputDistribution::kReverse,
+    InputDistribution::kOrganPipe, InputDistribution::kSawtooth};
+
+// Everything but random input defeats the plain last-item-pivot quicksort.
+const std::vector<InputDistribution> kNonRandom = {
+    InputDistribution::kSorted, InputDistribution::kReverse,
+    InputDistribution::kFewUnique, InputDistribution::kOrganPipe,
+    InputDistribution::kSawtooth};
+
+void BM_InsertionSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        InsertionSort(vec);
+    });
+}
+
+void BM_MergeSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        MergeSort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_BufferedMergeSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        BufferedMergeSort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_BufferedMergeSortReusedScratch(BenchmarkState &state) {
+    std::vector<int> scratch;
+    RunSortBenchmark(state, [&scratch](std::vector<int> &vec) {
+        BufferedMergeSort(vec, 0, (int)vec.size(), scratch);
+    });
+}
+
+void BM_MultiwayMergeSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        MultiwayMergeSort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_AdaptiveMergeSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        AdaptiveMergeSort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_HeapSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        HeapSort(vec);
+    });
+}
+
+void BM_Quicksort(BenchmarkState &state) {
+    if (SkipIfQuadratic(state, kNonRandom))
+        return;
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        Quicksort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_RandomizedQuicksort(BenchmarkState &state) {
+    if (SkipIfQuadratic(state, kManyDuplicates))
+        return;
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        RandomizedQuicksort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_RandomizedEqCheckQuicksort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        RandomizedEqCheckQuicksort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_HoareQuicksort(BenchmarkState &state) {
+    if (SkipIfQuadratic(state, kPresorted))
+        return;
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        HoareQuicksort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_ThreeWayQuicksort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        ThreeWayQuicksort(vec, 0, (int)vec.size());
+    });
+}
+
+/** The partition schemes, in the order of the benchmarks' arguments. */
+const std::vector<int> kPartitionSchemes = {
+    (int)PartitionScheme::kLomuto, (int)PartitionScheme::kBranchlessLomuto,
+    (int)PartitionScheme::kBlock, (int)PartitionScheme::kVectorized};
+
+/** Time one partition pass with the scheme given by the run's argument.
+ *
+ * Meant to be read alongside its branch-miss counts: on random input the
+ * plain Lomuto loop mispredicts about once every other item.
+ */
+void BM_QuicksortPartition(BenchmarkState &state) {
+    auto scheme = (PartitionScheme)state.argument();
+    RunSortBenchmark(state, [scheme](std::vector<int> &vec) {
+        QuicksortPartition(vec, 0, (int)vec.size(), true, scheme);
+    });
+}
+
+void BM_RandomizedQuicksortScheme(BenchmarkState &state) {
+    if (SkipIfQuadratic(state, kManyDuplicates))
+        return;
+    auto scheme = (PartitionScheme)state.argument();
+    RunSortBenchmark(state, [scheme](std::vector<int> &vec) {
+        RandomizedQuicksort(vec, 0, (int)vec.size(), scheme);
+    });
+}
+
+void BM_IntroSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        IntroSort(vec, 0, (int)vec.size());
+    });
+}
+
+void BM_LsdRadixSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        LsdRadixSort(vec);
+    });
+}
+
+void BM_AmericanFlagSort(BenchmarkState &state) {
+    RunSortBenchmark(state, [](std::vector<int> &vec) {
+        AmericanFlagSort(vec);
+    });
+}
+
+void BM_CountingSort(BenchmarkState &state) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    while (state.KeepRunning()) {
+        auto output = CountingSort(input);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_InsertionSort)->MaxSize(100000);
+BENCHMARK(BM_MergeSort);
+BENCHMARK(BM_BufferedMergeSort);
+BENCHMARK(BM_BufferedMergeSortReusedScratch);
+BENCHMARK(BM_MultiwayMergeSort);
+BENCHMARK(BM_AdaptiveMergeSort);
+BENCHMARK(BM_HeapSort);
+BENCHMARK(BM_Quicksort);
+BENCHMARK(BM_RandomizedQuicksort);
+BENCHMARK(BM_RandomizedEqCheckQuicksort);
+BENCHMARK(BM_HoareQuicksort);
+BENCHMARK(BM_QuicksortPartition)
+    ->Distributions({InputDistribution::kRandom, InputDistribution::kSorted})
+    ->Arguments(kPartitionSchemes)
+    ->PerfCounters({PerfEvent::kBranches, PerfEvent::kBranchMisses});
+BENCHMARK(BM_RandomizedQuicksortScheme)
+    ->Distributions({InputDistribution::kRandom, InputDistribution::kFewUnique})
+    ->Arguments(kPartitionSchemes)
+    ->PerfCounters({PerfEvent::kBranchMisses});
+BENCHMARK(BM_IntroSort);
+BENCHMARK(BM_ThreeWayQuicksort);
+BENCHMARK(BM_CountingSort);
+BENCHMARK(BM_LsdRadixSort);
+BENCHMARK(BM_AmericanFlagSort);
@@ -0,0 +1,133 @@
+/** Benchmarks for `sort_by_key.hpp`
+ *
+ * Each item is an int key with a 32-byte payload. The records are sorted
+ * as an array of structs, as separate key and payload arrays, and by
+ * argsorting the keys and then gathering the payloads.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/vector/sort_by_key.hpp"
+
+
+namespace {
+
+struct Payload {
+    double data[4];
+};
+
+struct Record {
+    int key;
+    Payload payload;
+};
+
+struct RecordKey {
+    int operator()(const Record &record) const {
+        return record.key;
+    }
+};
+
+std::vector<Payload> MakePayloads(const std::vector<int> &keys) {
+    std::vector<Payload> payloads(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        payloads[i].data[0] = keys[i];
+    return payloads;
+}
+
+/** Time a sort of a fresh copy of the keys and payloads on every iteration.
+ */
+template <typename SortFunction>
+void RunSortByKeyBenchmark(BenchmarkState &state, SortFunction sort) {
+    auto input_keys = GenerateBenchmarkInput(
+        state.size(), state.distribution());
+    auto input_payloads = MakePayloads(input_keys);
+    std::vector<int> keys;
+    std::vector<Payload> payloads;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        keys = input_keys;
+        payloads = input_payloads;
+        state.ResumeTiming();
+        sort(keys, payloads);
+    }
+}
+
+void BM_MergeSortRecords(BenchmarkState &state) {
+    auto keys = GenerateBenchmarkInput(state.size(), state.distribution());
+    auto payloads = MakePayloads(keys);
+    std::vector<Record> input;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        input.push_back({keys[i], payloads[i]});
+    std::vector<Record> records;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        records = input;
+        state.ResumeTiming();
+        BufferedMergeSort(records.begin(), records.end(), Less(), RecordKey());
+    }
+}
+
+void BM_MergeSortByKey(BenchmarkState &state) {
+    RunSortByKeyBenchmark(state, [](std::vector<int> &keys,
+                                    std::vector<Payload> &payloads) {
+        MergeSortByKey(keys.begin(), keys.end(), payloads.begin());
+    });
+}
+
+void BM_RadixSortByKey(BenchmarkState &state) {
+    RunSortByKeyBenchmark(state, [](std::vector<int> &keys,
+                                    std::vector<Payload> &payloads) {
+        RadixSortByKey(keys.begin(), keys.end(), payloads.begin());
+    });
+}
+
+void BM_RadixArgSortAndGather(BenchmarkState &state) {
+    std::vector<int> sorted_keys;
+    std::vector<Payload> sorted_payloads;
+    RunSortByKeyBenchmark(state, [&](std::vector<int> &keys,
+                                     std::vector<Payload> &payloads) {
+        auto perm = RadixArgSort<std::uint32_t>(keys.begin(), keys.end());
+        sorted_keys.resize(keys.size());
+        sorted_payloads.resize(payloads.size());
+        ApplyPermutation(
+            perm.begin(), perm.end(), keys.begin(), sorted_keys.begin());
+        ApplyPermutation(
+            perm.begin(), perm.end(), payloads.begin(),
+            sorted_payloads.begin());
+    });
+}
+
+/** Time gathering the payloads in sorted key order.
+ *
+ * `argument()` 0 is a plain gather loop, 1 is `ApplyPermutation`.
+ */
+void BM_GatherPayloads(BenchmarkState &state) {
+    auto keys = GenerateBenchmarkInput(state.size(), state.distribution());
+    auto payloads = MakePayloads(keys);
+    auto perm = RadixArgSort<std::uint32_t>(keys.begin(), keys.end());
+    std::vector<Payload> output(payloads.size());
+    while (state.KeepRunning()) {
+        if (state.argument() == 0) {
+            for (std::size_t i = 0; i < perm.size(); ++i)
+                output[i] = payloads[perm[i]];
+        }
+        else {
+            ApplyPermutation(
+                perm.begin(), perm.end(), payloads.begin(), output.begin());
+        }
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_MergeSortRecords);
+BENCHMARK(BM_MergeSortByKey);
+BENCHMARK(BM_RadixSortByKey);
+BENCHMARK(BM_RadixArgSortAndGather);
+BENCHMARK(BM_GatherPayloads)
+    ->Distributions({InputDistribution::kRandom})
+    ->Arguments({0, 1});
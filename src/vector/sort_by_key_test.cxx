@@ -0,0 +1,242 @@
+/** Unit tests for `sort_by_key.hpp`
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/vector/sort.hpp"
+#include "algorithm/vector/sort_by_key.hpp"
+
+
+namespace {
+
+/** Random keys with many duplicates, and distinct string payloads. */
+void MakeKeysAndValues(
+        const int size, std::vector<int> &keys,
+        std::vector<std::string> &values) {
+    keys.resize(size);
+    RandomlyFillVector(keys, -50, 50);
+    values.clear();
+    for (int i = 0; i < size; ++i)
+        values.push_back("value " + std::to_string(i));
+}
+
+/** The keys and values sorted as (key, value) structs by `std::stable_sort`.
+ */
+void StableSortPairs(
+        const std::vector<int> &keys, const std::vector<std::string> &values,
+        std::vector<int> &sorted_keys,
+        std::vector<std::string> &sorted_values) {
+    std::vector<std::pair<int, std::string>> pairs;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        pairs.push_back(std::make_pair(keys[i], values[i]));
+    std::stable_sort(
+        pairs.begin(), pairs.end(),
+        [](const std::pair<int, std::string> &a,
+           const std::pair<int, std::string> &b) {
+            return a.first < b.first;
+        });
+    sorted_keys.clear();
+    sorted_values.clear();
+    for (const auto &pair : pairs) {
+        sorted_keys.push_back(pair.first);
+        sorted_values.push_back(pair.second);
+    }
+}
+
+/** A payload that counts how often it is copied and moved. */
+struct CountedValue {
+    static int copies;
+    static int moves;
+
+    int id;
+
+    CountedValue() : id(0) {}
+    explicit CountedValue(const int id) : id(id) {}
+    CountedValue(const CountedValue &other) : id(other.id) { ++copies; }
+    CountedValue(CountedValue &&other) : id(other.id) { ++moves; }
+
+    CountedValue &operator=(const CountedValue &other) {
+        id = other.id;
+        ++copies;
+        return *this;
+    }
+
+    CountedValue &operator=(CountedValue &&other) {
+        id = other.id;
+        ++moves;
+        return *this;
+    }
+};
+
+int CountedValue::copies = 0;
+int CountedValue::moves = 0;
+
+} // namespace
+
+TEST(SortByKeyTest, StableSortsCarryValues) {
+    for (int size : {0, 1, 2, 17, 100, 1000}) {
+        std::vector<int> keys, expected_keys;
+        std::vector<std::string> values, expected_values;
+        MakeKeysAndValues(size, keys, values);
+        StableSortPairs(keys, values, expected_keys, expected_values);
+
+        auto test_keys(keys);
+        auto test_values(values);
+        MergeSortByKey(test_keys.begin(), test_keys.end(), test_values.begin());
+        EXPECT_EQ(test_keys, expected_keys) << "Merge sort by key failed!";
+        EXPECT_EQ(test_values, expected_values)
+            << "Merge sort by key did not carry the values stably!";
+
+        test_keys = keys;
+        test_values = values;
+        RadixSortByKey(test_keys.begin(), test_keys.end(), test_values.begin());
+        EXPECT_EQ(test_keys, expected_keys) << "Radix sort by key failed!";
+        EXPECT_EQ(test_values, expected_values)
+            << "Radix sort by key did not carry the values stably!";
+    }
+}
+
+TEST(SortByKeyTest, QuicksortCarriesValues) {
+    for (int size : {0, 1, 2, 17, 100, 1000}) {
+        std::vector<int> keys;
+        std::vector<std::string> values;
+        MakeKeysAndValues(size, keys, values);
+        std::vector<std::pair<int, std::string>> pairs, expected_pairs;
+        for (int i = 0; i < size; ++i)
+            expected_pairs.push_back(std::make_pair(keys[i], values[i]));
+        auto expected_keys(keys);
+        std::sort(expected_keys.begin(), expected_keys.end(), Greater());
+
+        QuicksortByKey(keys.begin(), keys.end(), values.begin(), Greater());
+        EXPECT_EQ(keys, expected_keys) << "Quicksort by key failed!";
+
+        // Equal keys may come in any order, but each value must stay
+        // with its key
+        for (int i = 0; i < size; ++i)
+            pairs.push_back(std::make_pair(keys[i], values[i]));
+        std::sort(pairs.begin(), pairs.end());
+        std::sort(expected_pairs.begin(), expected_pairs.end());
+        EXPECT_EQ(pairs, expected_pairs)
+            << "Quicksort by key separated values from their keys!";
+    }
+}
+
+TEST(SortByKeyTest, StableSortsMoveValuesWithoutCopying) {
+    std::vector<int> keys(1000);
+    RandomlyFillVector(keys, -50, 50);
+    std::vector<CountedValue> values;
+    for (int i = 0; i < (int)keys.size(); ++i)
+        values.push_back(CountedValue(i));
+    auto expected_keys(keys);
+    std::stable_sort(expected_keys.begin(), expected_keys.end());
+
+    auto test_keys(keys);
+    auto test_values(values);
+    CountedValue::copies = CountedValue::moves = 0;
+    MergeSortByKey(test_keys.begin(), test_keys.end(), test_values.begin());
+    EXPECT_EQ(test_keys, expected_keys) << "Merge sort by key failed!";
+    EXPECT_EQ(CountedValue::copies, 0)
+        << "Merge sort by key copied values instead of moving them!";
+    EXPECT_GT(CountedValue::moves, 0) << "Merge sort by key moved no values!";
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(keys[test_values[i].id], test_keys[i])
+            << "Merge sort by key separated a value from its key!";
+
+    test_keys = keys;
+    test_values = values;
+    CountedValue::copies = CountedValue::moves = 0;
+    RadixSortByKey(test_keys.begin(), test_keys.end(), test_values.begin());
+    EXPECT_EQ(test_keys, expected_keys) << "Radix sort by key failed!";
+    EXPECT_EQ(CountedValue::copies, 0)
+        << "Radix sort by key copied values instead of moving them!";
+    EXPECT_GT(CountedValue::moves, 0) << "Radix sort by key moved no values!";
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(keys[test_values[i].id], test_keys[i])
+            << "Radix sort by key separated a value from its key!";
+}
+
+TEST(SortByKeyTest, RadixSortsOtherKeyTypes) {
+    std::vector<double> keys = {2.5, -1.0, 0.0, -7.25, 2.5, 1e10, -0.5};
+    std::vector<std::int64_t> values = {0, 1, 2, 3, 4, 5, 6};
+    RadixSortByKey(keys.begin(), keys.end(), values.begin());
+    EXPECT_EQ(keys,
+              std::vector<double>({-7.25, -1.0, -0.5, 0.0, 2.5, 2.5, 1e10}))
+        << "Radix sort by double keys failed!";
+    EXPECT_EQ(values, std::vector<std::int64_t>({3, 1, 6, 2, 0, 4, 5}))
+        << "Radix sort by double keys did not carry the values!";
+}
+
+TEST(ArgSortTest, ArgSortsMatchStableSort) {
+    std::vector<int> vec(1000);
+    RandomlyFillVector(vec, -20, 20);
+    std::vector<std::size_t> expected_perm(vec.size());
+    std::iota(expected_perm.begin(), expected_perm.end(), 0);
+    std::stable_sort(
+        expected_perm.begin(), expected_perm.end(),
+        [&vec](std::size_t a, std::size_t b) { return vec[a] < vec[b]; });
+
+    EXPECT_EQ(ArgSort(vec.begin(), vec.end()), expected_perm)
+        << "Merge argsort did not match stable sort!";
+    EXPECT_EQ(RadixArgSort(vec.begin(), vec.end()), expected_perm)
+        << "Radix argsort did not match stable sort!";
+
+    auto perm = UnstableArgSort(vec.begin(), vec.end());
+    auto sorted_perm(perm);
+    std::sort(sorted_perm.begin(), sorted_perm.end());
+    std::vector<std::size_t> identity(vec.size());
+    std::iota(identity.begin(), identity.end(), 0);
+    EXPECT_EQ(sorted_perm, identity)
+        << "Unstable argsort did not return a permutation!";
+    for (std::size_t i = 1; i < perm.size(); ++i)
+        EXPECT_LE(vec[perm[i - 1]], vec[perm[i]])
+            << "Unstable argsort did not sort the items!";
+}
+
+TEST(ArgSortTest, ArgSortUsesProjection) {
+    std::vector<std::string> words = {"pear", "fig", "banana", "kiwi", "apple"};
+    auto perm = ArgSort<int>(
+        words.begin(), words.end(), Greater(),
+        [](const std::string &word) { return word.size(); });
+    EXPECT_EQ(perm, std::vector<int>({2, 4, 0, 3, 1}))
+        << "Argsort by projected length failed!";
+}
+
+TEST(ArgSortTest, ApplyPermutationGathers) {
+    std::vector<int> vec(1000);
+    RandomlyFillVector(vec, -1000, 1000);
+    auto perm = ArgSort(vec.begin(), vec.end());
+
+    std::vector<int> output(vec.size());
+    auto output_end = ApplyPermutation(
+        perm.begin(), perm.end(), vec.begin(), output.begin());
+    EXPECT_EQ(output_end, output.end());
+    auto expected_vec(vec);
+    std::sort(expected_vec.begin(), expected_vec.end());
+    EXPECT_EQ(output, expected_vec)
+        << "Applying the sorting permutation did not sort the vector!";
+}
+
+TEST(ArgSortTest, IntVectorWrappers) {
+    std::vector<int> keys = {3, 1, 3, 2, 1};
+    EXPECT_EQ(ArgSort(keys), std::vector<int>({1, 4, 3, 0, 2}))
+        << "Argsort of an int vector failed!";
+
+    std::vector<int> values = {0, 1, 2, 3, 4};
+    SortByKey(keys, values);
+    EXPECT_EQ(keys, std::vector<int>({1, 1, 2, 3, 3}))
+        << "Sort by key of int vectors failed!";
+    EXPECT_EQ(values, std::vector<int>({1, 4, 3, 0, 2}))
+        << "Sort by key of int vectors did not carry the values!";
+
+    values.pop_back();
+    EXPECT_THROW(SortByKey(keys, values), std::runtime_error);
+}
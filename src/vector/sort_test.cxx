@@ -4,6 +4,8 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <limits>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -63,6 +65,12 @@ TEST_F(GeneralSortingTest, PreservesSize1Vector) {
     ASSERT_EQ(singleton, original_singleton) << error_msg;
     MergeSort(singleton, 0, (int)singleton.size());
     ASSERT_EQ(singleton, original_singleton) << error_msg;
+    BufferedMergeSort(singleton, 0, (int)singleton.size());
+    ASSERT_EQ(singleton, original_singleton) << error_msg;
+    MultiwayMergeSort(singleton, 0, (int)singleton.size());
+    ASSERT_EQ(singleton, original_singleton) << error_msg;
+    AdaptiveMergeSort(singleton, 0, (int)singleton.size());
+    ASSERT_EQ(singleton, original_singleton) << error_msg;
     HeapSort(singleton);
     ASSERT_EQ(singleton, original_singleton) << error_msg;
     Quicksort(singleton, 0, (int)singleton.size());
@@ -73,12 +81,21 @@ TEST_F(GeneralSortingTest, PreservesSize1Vector) {
     ASSERT_EQ(singleton, original_singleton) << error_msg;
     HoareQuicksort(singleton, 0, (int)singleton.size());
     ASSERT_EQ(singleton, original_singleton) << error_msg;
+    IntroSort(singleton, 0, (int)singleton.size());
+    ASSERT_EQ(singleton, original_singleton) << error_msg;
+    ThreeWayQuicksort(singleton, 0, (int)singleton.size());
+    ASSERT_EQ(singleton, original_singleton) << error_msg;
+    LsdRadixSort(singleton);
+    ASSERT_EQ(singleton, original_singleton) << error_msg;
+    AmericanFlagSort(singleton);
+    ASSERT_EQ(singleton, original_singleton) << error_msg;
     auto out = CountingSort(
         singleton,
         *std::min_element(singleton.begin(), singleton.end()),
         *std::max_element(singleton.begin(), singleton.end())
     );
     ASSERT_EQ(out, original_singleton) << error_msg;
+    ASSERT_EQ(CountingSort(singleton), original_singleton) << error_msg;
 }
 
 TEST_F(GeneralSortingTest, CorrectlySortsKnownVector) {
@@ -98,6 +115,18 @@ TEST_F(GeneralSortingTest, CorrectlySortsKnownVector) {
     MergeSort(test_vec, 0, (int)test_vec.size());
     EXPECT_EQ(test_vec, vec_sorted) << error_msg;
 
+    test_vec = vec; // reset vector
+    BufferedMergeSort(test_vec, 0, (int)test_vec.size());
+    EXPECT_EQ(test_vec, vec_sorted) << error_msg;
+
+    test_vec = vec; // reset vector
+    MultiwayMergeSort(test_vec, 0, (int)test_vec.size());
+    EXPECT_EQ(test_vec, vec_sorted) << error_msg;
+
+    test_vec = vec; // reset vector
+    AdaptiveMergeSort(test_vec, 0, (int)test_vec.size());
+    EXPECT_EQ(test_vec, vec_sorted) << error_msg;
+
     test_vec = vec; // reset vector
     HeapSort(test_vec);
     EXPECT_EQ(test_vec, vec_sorted) << error_msg;
@@ -118,6 +147,22 @@ TEST_F(GeneralSortingTest, CorrectlySortsKnownVector) {
     HoareQuicksort(test_vec, 0, (int)test_vec.size());
     EXPECT_EQ(test_vec, vec_sorted) << error_msg;
 
+    test_vec = vec; // reset vector
+    IntroSort(test_vec, 0, (int)test_vec.size());
+    EXPECT_EQ(test_vec, vec_sorted) << error_msg;
+
+    test_vec = vec; // reset vector
+    ThreeWayQuicksort(test_vec, 0, (int)test_vec.size());
+    EXPECT_EQ(test_vec, vec_sorted) << error_msg;
+
+    test_vec = vec; // reset vector
+    LsdRadixSort(test_vec);
+    EXPECT_EQ(test_vec, vec_sorted) << error_msg;
+
+    test_vec = vec; // reset vector
+    AmericanFlagSort(test_vec);
+    EXPECT_EQ(test_vec, vec_sorted) << error_msg;
+
     test_vec = vec; // reset vector
     auto out_vec = CountingSort(
         test_vec,
@@ -125,6 +170,7 @@ TEST_F(GeneralSortingTest, CorrectlySortsKnownVector) {
         *std::max_element(test_vec.begin(), test_vec.end())
     );
     EXPECT_EQ(out_vec, vec_sorted) << error_msg;
+    EXPECT_EQ(CountingSort(test_vec), vec_sorted) << error_msg;
 }
 
 TEST(MergeSortedSubvectorsTest, CorrectlyMergesKnownVectors) {
@@ -136,6 +182,42 @@ TEST(MergeSortedSubvectorsTest, CorrectlyMergesKnownVectors) {
         << "Merged vector does not match expected vector.";
 }
 
+/** Merging must not rely on a sentinel that the data itself could contain.
+ */
+TEST(MergeSortedSubvectorsTest, CorrectlyMergesLargestInt) {
+    const int int_max = std::numeric_limits<int>::max();
+    std::vector<int> test_vec =     {2, int_max, int_max, 1, 5, int_max};
+    std::vector<int> expected_vec = {1, 2, 5, int_max, int_max, int_max};
+
+    MergeSortedSubvectors(test_vec, 0, 3, test_vec.size());
+    EXPECT_EQ(test_vec, expected_vec)
+        << "Merged vector does not match expected vector.";
+}
+
+/** Checks the buffered merge sort on a subvector, with a reused scratch.
+ */
+TEST_F(RandomizedSortingTest, BufferedMergeSortReusesScratch) {
+    std::string error_msg = "Buffered merge sort disagrees with std::sort!";
+
+    std::vector<int> scratch;
+    random_vec.push_back(std::numeric_limits<int>::max());
+    random_vec.push_back(std::numeric_limits<int>::min());
+
+    auto test_vec(random_vec);
+    auto expected_vec(random_vec);
+    std::sort(expected_vec.begin() + 1, expected_vec.end() - 1);
+
+    BufferedMergeSort(test_vec, 1, (int)test_vec.size() - 1, scratch);
+    EXPECT_EQ(test_vec, expected_vec) << error_msg;
+
+    // The scratch is now big enough to be reused as is
+    auto scratch_data = scratch.data();
+    test_vec = random_vec;
+    BufferedMergeSort(test_vec, 1, (int)test_vec.size() - 1, scratch);
+    EXPECT_EQ(test_vec, expected_vec) << error_msg;
+    EXPECT_EQ(scratch.data(), scratch_data) << "Scratch was reallocated!";
+}
+
 TEST_F(GeneralSortingTest, CorrectlyPartitionsKnownVector) {
     std::string error_msg =
         "Partitioned vector did not match with vector partitioned by hand!";
@@ -174,6 +256,27 @@ TEST_F(GeneralSortingTest, EqCheckCorrectlyPartitionsKnownVector) {
         "Unexpected values for partition indices";
 }
 
+TEST_F(GeneralSortingTest, ThreeWayCorrectlyPartitionsKnownVector) {
+    auto test_vec = vec4;
+    // The pivot is the first item, which is the smallest here
+    std::tuple<int, int> p =
+        ThreeWayQuicksortPartition(test_vec, 0, test_vec.size());
+    EXPECT_EQ(p, std::make_tuple(0, 1)) <<
+        "Unexpected values for partition indices";
+    EXPECT_EQ(test_vec[0], 2);
+
+    test_vec = {4, 8, 4, 2, 3, 4, 6, 4, 1};
+    p = ThreeWayQuicksortPartition(test_vec, 0, test_vec.size());
+    EXPECT_EQ(p, std::make_tuple(3, 7)) <<
+        "Unexpected values for partition indices";
+    for (int i = 0; i < 3; ++i)
+        EXPECT_LT(test_vec[i], 4) << "Item left of the pivots is not less!";
+    for (int i = 3; i < 7; ++i)
+        EXPECT_EQ(test_vec[i], 4) << "Pivot range holds another item!";
+    for (int i = 7; i < 9; ++i)
+        EXPECT_GT(test_vec[i], 4) << "Item right of the pivots is smaller!";
+}
+
 /** Checks that all sorting algorithms produce the same sort of a random vector.
  *
  * NOTE: If this passes, either all are correct or all are incorrect in the
@@ -194,6 +297,21 @@ TEST_F(RandomizedSortingTest, CorrectlySortsRandomVector) {
     MergeSort(merge_sort_vec, 0, (int)merge_sort_vec.size());
     ASSERT_EQ(merge_sort_vec, insertion_sort_vec) << error_msg;
 
+    auto buffered_merge_sort_vec(random_vec);
+    BufferedMergeSort(
+        buffered_merge_sort_vec, 0, (int)buffered_merge_sort_vec.size());
+    ASSERT_EQ(buffered_merge_sort_vec, merge_sort_vec) << error_msg;
+
+    auto multiway_merge_sort_vec(random_vec);
+    MultiwayMergeSort(
+        multiway_merge_sort_vec, 0, (int)multiway_merge_sort_vec.size());
+    ASSERT_EQ(multiway_merge_sort_vec, merge_sort_vec) << error_msg;
+
+    auto adaptive_merge_sort_vec(random_vec);
+    AdaptiveMergeSort(
+        adaptive_merge_sort_vec, 0, (int)adaptive_merge_sort_vec.size());
+    ASSERT_EQ(adaptive_merge_sort_vec, merge_sort_vec) << error_msg;
+
     auto heap_sort_vec(random_vec);
     HeapSort(heap_sort_vec);
     ASSERT_EQ(heap_sort_vec, merge_sort_vec) << error_msg;
@@ -220,6 +338,15 @@ TEST_F(RandomizedSortingTest, CorrectlySortsRandomVector) {
     EXPECT_EQ(randomized_eqcheck_quick_sort_vec, hoare_quick_sort_vec)
         << error_msg;
 
+    auto intro_sort_vec(random_vec);
+    IntroSort(intro_sort_vec, 0, (int)intro_sort_vec.size());
+    EXPECT_EQ(intro_sort_vec, hoare_quick_sort_vec) << error_msg;
+
+    auto three_way_quick_sort_vec(random_vec);
+    ThreeWayQuicksort(
+        three_way_quick_sort_vec, 0, (int)three_way_quick_sort_vec.size());
+    EXPECT_EQ(three_way_quick_sort_vec, intro_sort_vec) << error_msg;
+
     auto count_sort_vec(random_vec);
     auto out_vec = CountingSort(
         count_sort_vec,
@@ -228,5 +355,440 @@ TEST_F(RandomizedSortingTest, CorrectlySortsRandomVector) {
     );
     EXPECT_EQ(hoare_quick_sort_vec, out_vec)
         << error_msg;
+    EXPECT_EQ(CountingSort(count_sort_vec), out_vec) << error_msg;
+
+    auto radix_sort_vec(random_vec);
+    LsdRadixSort(radix_sort_vec);
+    EXPECT_EQ(radix_sort_vec, out_vec) << error_msg;
+
+    auto flag_sort_vec(random_vec);
+    AmericanFlagSort(flag_sort_vec);
+    EXPECT_EQ(flag_sort_vec, out_vec) << error_msg;
+}
+
+
+/** Checks introsort on large inputs that make naive quicksorts quadratic.
+ */
+TEST(IntroSortTest, CorrectlySortsPatternedVectors) {
+    const int size = 100000;
+    std::vector<int> ascending(size);
+    for (int i = 0; i < size; ++i)
+        ascending[i] = i;
+    std::vector<int> descending(ascending.rbegin(), ascending.rend());
+    std::vector<int> constant(size, 7);
+    std::vector<int> organ_pipe(ascending);
+    std::reverse(organ_pipe.begin() + size / 2, organ_pipe.end());
+
+    for (auto input : {ascending, descending, constant, organ_pipe}) {
+        auto expected_vec(input);
+        std::sort(expected_vec.begin(), expected_vec.end());
+        IntroSort(input, 0, (int)input.size());
+        EXPECT_EQ(input, expected_vec)
+            << "Introsort failed on a patterned vector!";
+    }
 }
 
+/** Checks three-way quicksort on large inputs with few distinct values, as
+ * well as the shapes that make naive quicksorts quadratic.
+ */
+TEST(ThreeWayQuicksortTest, CorrectlySortsPatternedVectors) {
+    const int size = 100000;
+    std::vector<int> few_unique(size);
+    RandomlyFillVector(few_unique, 0, 300);
+    std::vector<int> two_values(size);
+    RandomlyFillVector(two_values, 0, 1);
+    std::vector<int> ascending(size);
+    for (int i = 0; i < size; ++i)
+        ascending[i] = i % 1000;
+    std::vector<int> descending(ascending.rbegin(), ascending.rend());
+    std::vector<int> constant(size, 7);
+
+    for (auto input : {few_unique, two_values, ascending, descending,
+                       constant}) {
+        auto expected_vec(input);
+        std::sort(expected_vec.begin(), expected_vec.end());
+        ThreeWayQuicksort(input, 0, (int)input.size());
+        EXPECT_EQ(input, expected_vec)
+            << "Three-way quicksort failed on a patterned vector!";
+    }
+}
+
+/** Checks that introsort still sorts once its depth limit is used up.
+ */
+TEST_F(RandomizedSortingTest, IntroSortFallsBackToHeapSort) {
+    auto expected_vec(random_vec);
+    std::sort(expected_vec.begin(), expected_vec.end());
+
+    Less comp;
+    Identity proj;
+    detail::IntroSortLoop(random_vec.begin(), random_vec.end(), 0, comp, proj);
+    EXPECT_EQ(random_vec, expected_vec)
+        << "Introsort with no depth left did not sort the vector!";
+}
+
+/** Checks every partition scheme leaves a valid partition around the pivot.
+ *
+ * The vector is long enough for the block partition to go through several
+ * blocks before finishing off the middle.
+ */
+TEST(PartitionSchemeTest, AllSchemesPartitionCorrectly) {
+    std::vector<int> random_vec(1000);
+    RandomlyFillVector(random_vec, -20, 20);
+
+    for (PartitionScheme scheme : {PartitionScheme::kLomuto,
+                                   PartitionScheme::kBranchlessLomuto,
+                                   PartitionScheme::kBlock,
+                                   PartitionScheme::kVectorized}) {
+        for (bool equality_check : {true, false}) {
+            auto test_vec(random_vec);
+            int p = QuicksortPartition(
+                test_vec, 0, (int)test_vec.size(), equality_check, scheme);
+            int pivot = random_vec.back();
+            EXPECT_EQ(test_vec[p], pivot) << "Pivot was not put in place!";
+            for (int i = 0; i < p; ++i)
+                ASSERT_TRUE(equality_check ?
+                    test_vec[i] <= pivot : test_vec[i] < pivot)
+                    << "Item " << i << " belongs right of the pivot!";
+            for (int i = p + 1; i < (int)test_vec.size(); ++i)
+                ASSERT_TRUE(equality_check ?
+                    test_vec[i] > pivot : test_vec[i] >= pivot)
+                    << "Item " << i << " belongs left of the pivot!";
+
+            std::sort(test_vec.begin(), test_vec.end());
+            auto expected_vec(random_vec);
+            std::sort(expected_vec.begin(), expected_vec.end());
+            EXPECT_EQ(test_vec, expected_vec) << "Items were lost!";
+        }
+    }
+}
+
+TEST_F(RandomizedSortingTest, QuicksortsAgreeAcrossSchemes) {
+    auto expected_vec(random_vec);
+    std::sort(expected_vec.begin(), expected_vec.end());
+
+    for (PartitionScheme scheme : {PartitionScheme::kBranchlessLomuto,
+                                   PartitionScheme::kBlock,
+                                   PartitionScheme::kVectorized}) {
+        auto test_vec(random_vec);
+        Quicksort(test_vec, 0, (int)test_vec.size(), scheme);
+        EXPECT_EQ(test_vec, expected_vec) << "Quicksort failed!";
+
+        test_vec = random_vec;
+        RandomizedQuicksort(test_vec, 0, (int)test_vec.size(), scheme);
+        EXPECT_EQ(test_vec, expected_vec) << "Randomized quicksort failed!";
+
+        test_vec = random_vec;
+        RandomizedEqCheckQuicksort(test_vec, 0, (int)test_vec.size(), scheme);
+        EXPECT_EQ(test_vec, expected_vec)
+            << "Randomized eq-check quicksort failed!";
+    }
+}
+
+/** Checks radix sort on keys far apart, which counting sort can't handle.
+ */
+TEST(RadixSortTest, CorrectlySortsFullRangeInts) {
+    std::vector<int> test_vec = {
+        std::numeric_limits<int>::max(), -1, 0, std::numeric_limits<int>::min(),
+        1 << 20, -(1 << 20), 42, std::numeric_limits<int>::min() + 1, 42};
+    auto expected_vec(test_vec);
+    std::sort(expected_vec.begin(), expected_vec.end());
+
+    LsdRadixSort(test_vec);
+    EXPECT_EQ(test_vec, expected_vec) << "Radix sort did not match std::sort!";
+
+    std::vector<int> random_vec(5000);
+    for (int &item : random_vec)
+        item = (int)(((unsigned int)RandomInteger(0, 65535) << 16) |
+                     (unsigned int)RandomInteger(0, 65535));
+    expected_vec = random_vec;
+    std::sort(expected_vec.begin(), expected_vec.end());
+    auto flag_sort_vec(random_vec);
+    LsdRadixSort(random_vec);
+    EXPECT_EQ(random_vec, expected_vec) << "Radix sort did not match std::sort!";
+    AmericanFlagSort(flag_sort_vec);
+    EXPECT_EQ(flag_sort_vec, expected_vec)
+        << "American flag sort did not match std::sort!";
+}
+
+/** Checks that counting sort radix sorts keys too far apart for a histogram.
+ */
+TEST(CountingSortTest, FallsBackToRadixSortForFullRangeKeys) {
+    std::vector<int> extremes = {
+        std::numeric_limits<int>::max(), std::numeric_limits<int>::min()};
+    EXPECT_EQ(CountingSort(extremes),
+              std::vector<int>({std::numeric_limits<int>::min(),
+                                std::numeric_limits<int>::max()}))
+        << "Counting sort of the smallest and largest ints failed!";
+
+    std::vector<int> random_vec(5000);
+    for (int &item : random_vec)
+        item = (int)(((unsigned int)RandomInteger(0, 65535) << 16) |
+                     (unsigned int)RandomInteger(0, 65535));
+    auto expected_vec(random_vec);
+    std::sort(expected_vec.begin(), expected_vec.end());
+    EXPECT_EQ(CountingSort(random_vec), expected_vec)
+        << "Counting sort of full-range ints did not match std::sort!";
+
+    // 64-bit keys whose range overflows a long long, with ties to keep
+    std::vector<std::pair<long long, int>> records;
+    for (int i = 0; i < 100; ++i)
+        records.push_back(std::make_pair(
+            i % 3 == 0 ? std::numeric_limits<long long>::min() :
+            i % 3 == 1 ? std::numeric_limits<long long>::max() :
+            (long long)RandomInteger(-5, 5) << 40, i));
+    auto expected_records(records);
+    auto key = [](const std::pair<long long, int> &record) {
+        return record.first;
+    };
+    std::stable_sort(
+        expected_records.begin(), expected_records.end(),
+        [&key](const std::pair<long long, int> &a,
+               const std::pair<long long, int> &b) {
+            return key(a) < key(b);
+        });
+    std::vector<std::pair<long long, int>> output(records.size());
+    CountingSort(records.begin(), records.end(), output.begin(), key);
+    EXPECT_EQ(output, expected_records)
+        << "Counting sort of full-range 64-bit keys was not stable!";
+}
+
+/** Checks the key bit-twiddling for other integer widths and floats.
+ */
+TEST(RadixSortTest, CorrectlySortsOtherKeyTypes) {
+    std::string error_msg = "Radix sort did not match std::sort!";
+
+    std::vector<double> doubles = {
+        2.5, -1.25, 8., -0., 3.75, -1e300, 0.5, 1e-300, -7., 0.,
+        std::numeric_limits<double>::infinity(), -1.25};
+    auto expected_doubles(doubles);
+    std::sort(expected_doubles.begin(), expected_doubles.end());
+    auto flag_sort_doubles(doubles);
+    LsdRadixSort(doubles.begin(), doubles.end());
+    EXPECT_EQ(doubles, expected_doubles) << error_msg;
+    AmericanFlagSort(flag_sort_doubles.begin(), flag_sort_doubles.end());
+    EXPECT_EQ(flag_sort_doubles, expected_doubles) << error_msg;
+
+    std::vector<float> floats = {2.5f, -1.25f, 8.f, 3.75f, -3e30f, 0.5f};
+    auto expected_floats(floats);
+    std::sort(expected_floats.begin(), expected_floats.end());
+    LsdRadixSort(floats.begin(), floats.end());
+    EXPECT_EQ(floats, expected_floats) << error_msg;
+
+    std::vector<long long> wide = {
+        5000000000LL, -3, 6, -9000000000LL, 8, 3,
+        std::numeric_limits<long long>::min(), 1};
+    auto expected_wide(wide);
+    std::sort(expected_wide.begin(), expected_wide.end());
+    auto flag_sort_wide(wide);
+    LsdRadixSort(wide.begin(), wide.end());
+    EXPECT_EQ(wide, expected_wide) << error_msg;
+    AmericanFlagSort(flag_sort_wide.begin(), flag_sort_wide.end());
+    EXPECT_EQ(flag_sort_wide, expected_wide) << error_msg;
+
+    std::vector<unsigned char> bytes = {200, 3, 255, 0, 17, 3};
+    auto expected_bytes(bytes);
+    std::sort(expected_bytes.begin(), expected_bytes.end());
+    LsdRadixSort(bytes.begin(), bytes.end());
+    EXPECT_EQ(bytes, expected_bytes) << error_msg;
+}
+
+
+/** A record sorted by one of its members, for testing projections.
+ */
+struct KeyedRecord {
+    long long key;
+    int payload;
+
+    bool operator==(const KeyedRecord &other) const {
+        return key == other.key && payload == other.payload;
+    }
+};
+
+/** Projection giving the sort key of a `KeyedRecord`.
+ */
+struct RecordKey {
+    long long operator()(const KeyedRecord &record) const {
+        return record.key;
+    }
+};
+
+/** Checks that the generic sorts handle key types other than int.
+ */
+TEST(GenericSortingTest, CorrectlySortsOtherKeyTypes) {
+    std::string error_msg = "Generic sort did not match std::sort!";
+
+    std::vector<double> doubles = {2.5, -1.25, 8., 3.75, -1.25, 0.5, 7.};
+    auto expected_doubles(doubles);
+    std::sort(expected_doubles.begin(), expected_doubles.end());
+
+    std::vector<long long> wide = {
+        5000000000LL, -3, 6, -9000000000LL, 8, 3, 1};
+    auto expected_wide(wide);
+    std::sort(expected_wide.begin(), expected_wide.end());
+
+    auto test_doubles(doubles);
+    auto test_wide(wide);
+    InsertionSort(test_doubles.begin(), test_doubles.end());
+    InsertionSort(test_wide.begin(), test_wide.end());
+    EXPECT_EQ(test_doubles, expected_doubles) << error_msg;
+    EXPECT_EQ(test_wide, expected_wide) << error_msg;
+
+    test_doubles = doubles;
+    test_wide = wide;
+    MergeSort(test_doubles.begin(), test_doubles.end());
+    MergeSort(test_wide.begin(), test_wide.end());
+    EXPECT_EQ(test_doubles, expected_doubles) << error_msg;
+    EXPECT_EQ(test_wide, expected_wide) << error_msg;
+
+    test_doubles = doubles;
+    test_wide = wide;
+    HeapSort(test_doubles.begin(), test_doubles.end());
+    HeapSort(test_wide.begin(), test_wide.end());
+    EXPECT_EQ(test_doubles, expected_doubles) << error_msg;
+    EXPECT_EQ(test_wide, expected_wide) << error_msg;
+
+    test_doubles = doubles;
+    test_wide = wide;
+    RandomizedEqCheckQuicksort(test_doubles.begin(), test_doubles.end());
+    HoareQuicksort(test_wide.begin(), test_wide.end());
+    EXPECT_EQ(test_doubles, expected_doubles) << error_msg;
+    EXPECT_EQ(test_wide, expected_wide) << error_msg;
+}
+
+/** Checks that the generic sorts order records by their projected keys.
+ *
+ * The stable sorts must also keep records with equal keys in input order.
+ */
+TEST(GenericSortingTest, StablySortsRecordsByProjection) {
+    std::string error_msg = "Records were not sorted stably by key!";
+
+    std::vector<KeyedRecord> records = {
+        {3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4}, {2, 5}, {3, 6}};
+    std::vector<KeyedRecord> expected = {
+        {1, 1}, {1, 4}, {2, 3}, {2, 5}, {3, 0}, {3, 2}, {3, 6}};
+
+    auto test_records(records);
+    InsertionSort(
+        test_records.begin(), test_records.end(), Less(), RecordKey());
+    EXPECT_EQ(test_records, expected) << error_msg;
+
+    test_records = records;
+    MergeSort(test_records.begin(), test_records.end(), Less(), RecordKey());
+    EXPECT_EQ(test_records, expected) << error_msg;
+
+    for (int ways = 2; ways <= 4; ++ways) {
+        test_records = records;
+        MultiwayMergeSort(
+            test_records.begin(), test_records.end(), Less(), RecordKey(),
+            ways);
+        EXPECT_EQ(test_records, expected) << error_msg;
+    }
+
+    test_records = records;
+    AdaptiveMergeSort(
+        test_records.begin(), test_records.end(), Less(), RecordKey());
+    EXPECT_EQ(test_records, expected) << error_msg;
+
+    std::vector<KeyedRecord> output(records.size());
+    CountingSort(
+        records.begin(), records.end(), output.begin(), 1, 3, RecordKey());
+    EXPECT_EQ(output, expected) << error_msg;
+
+    // Finding the key range itself
+    std::fill(output.begin(), output.end(), KeyedRecord());
+    CountingSort(records.begin(), records.end(), output.begin(), RecordKey());
+    EXPECT_EQ(output, expected) << error_msg;
+
+    test_records = records;
+    LsdRadixSort(test_records.begin(), test_records.end(), RecordKey());
+    EXPECT_EQ(test_records, expected) << error_msg;
+
+    test_records = records;
+    Quicksort(test_records.begin(), test_records.end(), Less(), RecordKey());
+    for (std::size_t i = 0; i < test_records.size(); ++i)
+        EXPECT_EQ(test_records[i].key, expected[i].key)
+            << "Records were not sorted by key!";
+}
+
+/** Checks the adaptive merge sort on large patterned inputs.
+ *
+ * The records are keyed so that there are many equal keys, and must end up
+ * as `std::stable_sort` leaves them; the patterns exercise run detection,
+ * descending runs and galloping merges.
+ */
+TEST(AdaptiveMergeSortTest, StablySortsPatternedVectors) {
+    const int size = 20000;
+    std::vector<KeyedRecord> ascending(size);
+    for (int i = 0; i < size; ++i)
+        ascending[i] = {i / 3, i};
+    std::vector<KeyedRecord> descending(ascending.rbegin(), ascending.rend());
+    std::vector<KeyedRecord> sawtooth(ascending);
+    for (int i = 0; i < size; ++i)
+        sawtooth[i].key = i % 1000;
+    std::vector<KeyedRecord> nearly_sorted(ascending);
+    for (int i = 0; i < 20; ++i)
+        std::swap(nearly_sorted[RandomInteger(0, size - 1)],
+                  nearly_sorted[RandomInteger(0, size - 1)]);
+    std::vector<KeyedRecord> random(ascending);
+    for (auto &record : random)
+        record.key = RandomInteger(0, 100);
+
+    for (auto input : {ascending, descending, sawtooth, nearly_sorted,
+                       random}) {
+        auto expected_vec(input);
+        std::stable_sort(
+            expected_vec.begin(), expected_vec.end(),
+            [](const KeyedRecord &a, const KeyedRecord &b) {
+                return a.key < b.key;
+            });
+        AdaptiveMergeSort(input.begin(), input.end(), Less(), RecordKey());
+        EXPECT_EQ(input, expected_vec)
+            << "Adaptive merge sort failed on a patterned vector!";
+    }
+}
+
+/** Checks that sorted and reversed inputs take one comparison per item.
+ */
+TEST(AdaptiveMergeSortTest, SortsRunsInLinearTime) {
+    const int size = 10000;
+    std::vector<int> ascending(size);
+    for (int i = 0; i < size; ++i)
+        ascending[i] = i;
+    std::vector<int> descending(ascending.rbegin(), ascending.rend());
+
+    for (auto input : {ascending, descending}) {
+        long long comparisons = 0;
+        AdaptiveMergeSort(
+            input.begin(), input.end(), [&comparisons](int a, int b) {
+                ++comparisons;
+                return a < b;
+            });
+        EXPECT_EQ(input, ascending) << "Adaptive merge sort failed!";
+        EXPECT_EQ(comparisons, size - 1)
+            << "Adaptive merge sort did not find the single run!";
+    }
+}
+
+/** Checks that the generic sorts respect a custom comparator.
+ */
+TEST_F(GeneralSortingTest, GenericSortsUseComparator) {
+    std::string error_msg = "Sorting with a descending comparator failed!";
+
+    std::vector<int> expected_vec(vec_sorted.rbegin(), vec_sorted.rend());
+
+    auto test_vec(vec);
+    SelectionSort(test_vec.begin(), test_vec.end(), Greater());
+    EXPECT_EQ(test_vec, expected_vec) << error_msg;
+
+    test_vec = vec;
+    HeapSort(test_vec.begin(), test_vec.end(), Greater());
+    EXPECT_EQ(test_vec, expected_vec) << error_msg;
+
+    test_vec = vec;
+    RandomizedQuicksort(test_vec.begin(), test_vec.end(), Greater());
+    EXPECT_EQ(test_vec, expected_vec) << error_msg;
+
+    test_vec = vec;
+    InsertionSort(test_vec, false);
+    EXPECT_EQ(test_vec, expected_vec) << error_msg;
+}
@@ -0,0 +1,76 @@
+#include "algorithm/vector/sorting_network.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+
+#include "algorithm/simd.hpp"
+#include "bitonic_network.hpp"
+
+
+namespace {
+
+/** Network operations on single ints (one lane per "register").
+ */
+struct ScalarOps {
+    typedef int Register;
+    static const int kLanes = 1;
+
+    static Register Load(const int *data) { return *data; }
+    static void Store(int *data, const Register value) { *data = value; }
+    static Register Min(const Register a, const Register b) {
+        return b < a ? b : a;
+    }
+    static Register Max(const Register a, const Register b) {
+        return b < a ? a : b;
+    }
+    static Register PermuteLanes(const Register value, int) { return value; }
+    static Register CompareExchangeLanes(const Register value, int) {
+        return value;
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+void SortingNetworkScalar(int *data, const int size) {
+    BitonicSortNetwork<ScalarOps>(data, size);
+}
+
+} // namespace detail
+
+void SortingNetworkSort(int *data, const int size) {
+    assert(size <= kSortingNetworkMaxSize);
+    if (size < 2)
+        return;
+
+    int network_size = 8;
+    while (network_size < size)
+        network_size *= 2;
+
+    // Odd sizes are padded with the largest int, which sorts to the end
+    int padded[kSortingNetworkMaxSize];
+    int *network_data = data;
+    if (network_size != size) {
+        std::copy(data, data + size, padded);
+        std::fill(padded + size, padded + network_size, INT_MAX);
+        network_data = padded;
+    }
+
+    switch (ActiveSimdLevel()) {
+    case SimdLevel::kAvx512:
+    case SimdLevel::kAvx2:
+        detail::SortingNetworkAvx2(network_data, network_size);
+        break;
+    case SimdLevel::kSse41:
+        detail::SortingNetworkSse41(network_data, network_size);
+        break;
+    case SimdLevel::kScalar:
+        detail::SortingNetworkScalar(network_data, network_size);
+        break;
+    }
+
+    if (network_data != data)
+        std::copy(padded, padded + size, data);
+}
@@ -0,0 +1,72 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt)
+
+#include "bitonic_network.hpp"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+
+namespace {
+
+/** Network operations on AVX2 registers of 8 ints.
+ */
+struct Avx2Ops {
+    typedef __m256i Register;
+    static const int kLanes = 8;
+
+    static Register Load(const int *data) {
+        return _mm256_loadu_si256((const __m256i *)data);
+    }
+    static void Store(int *data, const Register value) {
+        _mm256_storeu_si256((__m256i *)data, value);
+    }
+    static Register Min(const Register a, const Register b) {
+        return _mm256_min_epi32(a, b);
+    }
+    static Register Max(const Register a, const Register b) {
+        return _mm256_max_epi32(a, b);
+    }
+    static Register PermuteLanes(const Register value, const int lane_xor) {
+        if (lane_xor == 0)
+            return value;
+        Register lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        return _mm256_permutevar8x32_epi32(
+            value, _mm256_xor_si256(lanes, _mm256_set1_epi32(lane_xor)));
+    }
+    static Register CompareExchangeLanes(
+            const Register value, const int lane_xor) {
+        Register partner = PermuteLanes(value, lane_xor);
+        // The lane of each pair with the top bit of `lane_xor` set is the
+        // upper one, and gets the larger int
+        int upper_bit = lane_xor >= 4 ? 4 : lane_xor >= 2 ? 2 : 1;
+        Register takes_max = _mm256_cmpgt_epi32(
+            _mm256_and_si256(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                             _mm256_set1_epi32(upper_bit)),
+            _mm256_setzero_si256());
+        return _mm256_blendv_epi8(
+            Min(value, partner), Max(value, partner), takes_max);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+void SortingNetworkAvx2(int *data, const int size) {
+    BitonicSortNetwork<Avx2Ops>(data, size);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+void SortingNetworkAvx2(int *data, const int size) {
+    SortingNetworkScalar(data, size);
+}
+
+} // namespace detail
+
+#endif
@@ -0,0 +1,89 @@
+/** Benchmarks for `sorting_network.cpp`
+ *
+ * These measure leaf throughput: the input is cut into consecutive leaves of
+ * `argument()` ints, and each leaf is sorted on its own, the way the
+ * recursive sorts finish off their short ranges.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/simd.hpp"
+#include "algorithm/vector/generic_sort.hpp"
+#include "algorithm/vector/sorting_network.hpp"
+
+
+namespace {
+
+const std::vector<int> kLeafSizes = {8, 16, 32, 64};
+
+/** Time sorting every leaf of a fresh copy of the input.
+ */
+template <typename LeafSortFunction>
+void RunLeafBenchmark(BenchmarkState &state, LeafSortFunction sort_leaf) {
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    int leaf_size = state.argument();
+    std::vector<int> vec;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        vec = input;
+        state.ResumeTiming();
+        for (int begin = 0; begin < (int)vec.size(); begin += leaf_size) {
+            int size = std::min(leaf_size, (int)vec.size() - begin);
+            sort_leaf(vec.data() + begin, size);
+        }
+    }
+}
+
+/** Time the sorting networks at one SIMD level (or skip, if unsupported).
+ */
+void RunSortingNetworkBenchmark(BenchmarkState &state, const SimdLevel level) {
+    if (SetSimdLevel(level) != level) {
+        state.SkipWithMessage("SIMD level not supported by this CPU");
+        SetSimdLevel(DetectSimdLevel());
+        return;
+    }
+    RunLeafBenchmark(state, [](int *data, const int size) {
+        SortingNetworkSort(data, size);
+    });
+    SetSimdLevel(DetectSimdLevel());
+}
+
+void BM_LeafInsertionSort(BenchmarkState &state) {
+    RunLeafBenchmark(state, [](int *data, const int size) {
+        InsertionSort(data, data + size);
+    });
+}
+
+void BM_LeafSortingNetworkScalar(BenchmarkState &state) {
+    RunSortingNetworkBenchmark(state, SimdLevel::kScalar);
+}
+
+void BM_LeafSortingNetworkSse41(BenchmarkState &state) {
+    RunSortingNetworkBenchmark(state, SimdLevel::kSse41);
+}
+
+void BM_LeafSortingNetworkAvx2(BenchmarkState &state) {
+    RunSortingNetworkBenchmark(state, SimdLevel::kAvx2);
+}
+
+} // namespace
+
+BENCHMARK(BM_LeafInsertionSort)
+    ->Distributions({InputDistribution::kRandom})
+    ->Arguments(kLeafSizes)
+    ->PerfCounters({PerfEvent::kBranchMisses});
+BENCHMARK(BM_LeafSortingNetworkScalar)
+    ->Distributions({InputDistribution::kRandom})
+    ->Arguments(kLeafSizes)
+    ->PerfCounters({PerfEvent::kBranchMisses});
+BENCHMARK(BM_LeafSortingNetworkSse41)
+    ->Distributions({InputDistribution::kRandom})
+    ->Arguments(kLeafSizes)
+    ->PerfCounters({PerfEvent::kBranchMisses});
+BENCHMARK(BM_LeafSortingNetworkAvx2)
+    ->Distributions({InputDistribution::kRandom})
+    ->Arguments(kLeafSizes)
+    ->PerfCounters({PerfEvent::kBranchMisses});
@@ -0,0 +1,76 @@
+// Compiled with SSE4.1 enabled (see CMakeLists.txt)
+
+#include "bitonic_network.hpp"
+
+#ifdef __SSE4_1__
+
+#include <smmintrin.h>
+
+
+namespace {
+
+/** Network operations on SSE registers of 4 ints.
+ */
+struct Sse41Ops {
+    typedef __m128i Register;
+    static const int kLanes = 4;
+
+    static Register Load(const int *data) {
+        return _mm_loadu_si128((const __m128i *)data);
+    }
+    static void Store(int *data, const Register value) {
+        _mm_storeu_si128((__m128i *)data, value);
+    }
+    static Register Min(const Register a, const Register b) {
+        return _mm_min_epi32(a, b);
+    }
+    static Register Max(const Register a, const Register b) {
+        return _mm_max_epi32(a, b);
+    }
+    static Register PermuteLanes(const Register value, const int lane_xor) {
+        switch (lane_xor) {
+        case 1:
+            return _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1));
+        case 2:
+            return _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+        case 3:
+            return _mm_shuffle_epi32(value, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        return value;
+    }
+    static Register CompareExchangeLanes(
+            const Register value, const int lane_xor) {
+        Register partner = PermuteLanes(value, lane_xor);
+        // The lane of each pair with the top bit of `lane_xor` set is the
+        // upper one, and gets the larger int
+        int upper_bit = lane_xor >= 2 ? 2 : 1;
+        Register takes_max = _mm_cmpgt_epi32(
+            _mm_and_si128(_mm_setr_epi32(0, 1, 2, 3),
+                          _mm_set1_epi32(upper_bit)),
+            _mm_setzero_si128());
+        return _mm_blendv_epi8(
+            Min(value, partner), Max(value, partner), takes_max);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+void SortingNetworkSse41(int *data, const int size) {
+    BitonicSortNetwork<Sse41Ops>(data, size);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+void SortingNetworkSse41(int *data, const int size) {
+    SortingNetworkScalar(data, size);
+}
+
+} // namespace detail
+
+#endif
@@ -0,0 +1,111 @@
+/** Unit tests for `sorting_network.cpp`
+ */
+
+#include <algorithm>
+#include <climits>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/simd.hpp"
+#include "algorithm/vector/sort.hpp"
+#include "algorithm/vector/sorting_network.hpp"
+
+
+/** Runs each test once per SIMD level the CPU supports.
+ */
+class SortingNetworkTest: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        SetSimdLevel(DetectSimdLevel());
+    }
+
+    /** Return the levels to test, from scalar up to the detected one. */
+    std::vector<SimdLevel> SupportedLevels() {
+        std::vector<SimdLevel> levels;
+        for (int level = 0; level <= (int)DetectSimdLevel(); ++level)
+            levels.push_back((SimdLevel)level);
+        return levels;
+    }
+};
+
+TEST_F(SortingNetworkTest, CorrectlySortsEverySize) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        for (int size = 0; size <= kSortingNetworkMaxSize; ++size) {
+            std::string error_msg = std::string("The ") +
+                SimdLevelName(level) + " network did not sort " +
+                std::to_string(size) + " ints!";
+            for (int trial = 0; trial < 20; ++trial) {
+                std::vector<int> vec(size);
+                RandomlyFillVector(vec, -50, 50);
+                std::vector<int> expected_vec(vec);
+                std::sort(expected_vec.begin(), expected_vec.end());
+
+                SortingNetworkSort(vec.data(), size);
+                EXPECT_EQ(vec, expected_vec) << error_msg;
+            }
+        }
+    }
+}
+
+TEST_F(SortingNetworkTest, CorrectlySortsExtremeValues) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        // Padding uses INT_MAX, which must not displace real ones
+        for (int size : {5, 8, 13, 64}) {
+            std::vector<int> vec(size);
+            for (int i = 0; i < size; ++i)
+                vec[i] = i % 3 == 0 ? INT_MAX : i % 3 == 1 ? INT_MIN : -i;
+            std::vector<int> expected_vec(vec);
+            std::sort(expected_vec.begin(), expected_vec.end());
+
+            SortingNetworkSort(vec.data(), size);
+            EXPECT_EQ(vec, expected_vec)
+                << "The " << SimdLevelName(level)
+                << " network mishandled INT_MIN/INT_MAX!";
+        }
+    }
+}
+
+TEST_F(SortingNetworkTest, SortsAreCorrectWithNetworkLeaves) {
+    // The recursive sorts hand their int leaves to the networks, so run them
+    // through every level
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        std::vector<int> vec(1000 + RandomInteger(0, 1000));
+        RandomlyFillVector(vec, -100, 100);
+        std::vector<int> expected_vec(vec);
+        std::sort(expected_vec.begin(), expected_vec.end());
+
+        std::vector<int> merge_sorted(vec);
+        MergeSort(merge_sorted, 0, (int)merge_sorted.size());
+        EXPECT_EQ(merge_sorted, expected_vec)
+            << "Merge sort failed with " << SimdLevelName(level) << " leaves!";
+
+        std::vector<int> quicksorted(vec);
+        RandomizedQuicksort(quicksorted, 0, (int)quicksorted.size());
+        EXPECT_EQ(quicksorted, expected_vec)
+            << "Quicksort failed with " << SimdLevelName(level) << " leaves!";
+
+        std::vector<int> radix_sorted(vec);
+        AmericanFlagSort(radix_sorted);
+        EXPECT_EQ(radix_sorted, expected_vec)
+            << "American flag sort failed with " << SimdLevelName(level)
+            << " leaves!";
+    }
+}
+
+TEST(SimdLevelTest, SetSimdLevelIsCappedByTheCpu) {
+    EXPECT_EQ(SetSimdLevel(SimdLevel::kScalar), SimdLevel::kScalar)
+        << "The scalar level must always be available!";
+    EXPECT_EQ(ActiveSimdLevel(), SimdLevel::kScalar)
+        << "The level set was not the one used!";
+
+    EXPECT_EQ(SetSimdLevel(SimdLevel::kAvx512), DetectSimdLevel())
+        << "A level above the CPU's must be lowered to it!";
+    EXPECT_EQ(ActiveSimdLevel(), DetectSimdLevel())
+        << "The level set was not the one used!";
+}
@@ -0,0 +1,53 @@
+/** Static B+ tree search kernel (internal to `StaticBPlusTreeIndex`).
+ *
+ * Written once against an `Ops` class, and instantiated by each instruction
+ * set's source file. `Ops::CountLess(node, value)` returns how many of the
+ * `kStaticBTreeNodeKeys` ints at `node` (a cache-line-aligned pointer) are
+ * less than `value`.
+ */
+
+#ifndef ALGORITHMS_STUDY_CPP_STATIC_BPLUS_TREE_HPP
+#define ALGORITHMS_STUDY_CPP_STATIC_BPLUS_TREE_HPP
+
+#include <cstddef>
+
+#include "algorithm/vector/static_search.hpp"
+
+
+namespace detail {
+
+/** Search the tree for the first leaf key not less than `value`.
+ *
+ * @param keys          The nodes' keys, leaves first.
+ * @param layer_offsets Index of each layer's first node, leaves first.
+ * @param height        Number of layers (at least 1).
+ * @param value         Value to be searched for.
+ * @return              Position of that key among the leaves' keys.
+ */
+template <typename Ops>
+std::size_t StaticBPlusTreeSearch(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value) {
+    const int node_keys = kStaticBTreeNodeKeys;
+    std::size_t k = 0;
+    for (int h = height - 1; h > 0; --h) {
+        int i = Ops::CountLess(
+            keys + (layer_offsets[h] + k) * node_keys, value);
+        k = k * (node_keys + 1) + i;
+    }
+    return k * node_keys + Ops::CountLess(keys + k * node_keys, value);
+}
+
+std::size_t StaticBPlusTreeSearchScalar(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value);
+std::size_t StaticBPlusTreeSearchAvx2(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value);
+std::size_t StaticBPlusTreeSearchAvx512(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value);
+
+} // namespace detail
+
+#endif //ALGORITHMS_STUDY_CPP_STATIC_BPLUS_TREE_HPP
@@ -0,0 +1,184 @@
+#include "algorithm/vector/static_search.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "algorithm/simd.hpp"
+#include "static_bplus_tree.hpp"
+
+
+namespace {
+
+/** Ints per cache line. */
+const std::size_t kLineInts = 16;
+
+/** Number of ints to skip from the start of `storage` to reach a cache line
+ * boundary (`storage` must have `kLineInts - 1` ints to spare).
+ */
+std::size_t CacheLineOffset(const std::vector<int> &storage) {
+    auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+    auto misalignment = address % (kLineInts * sizeof(int));
+    return misalignment == 0
+        ? 0 : (kLineInts * sizeof(int) - misalignment) / sizeof(int);
+}
+
+/** Shift out the trailing one bits of `k`, and the zero bit above them. */
+std::size_t DropTrailingOnes(std::size_t k) {
+#if defined(__GNUC__)
+    return k >> (__builtin_ctzll(~(unsigned long long)k) + 1);
+#else
+    while (k & 1)
+        k >>= 1;
+    return k >> 1;
+#endif
+}
+
+/** Index of the highest set bit of `k` (which must not be 0). */
+int HighestBit(std::size_t k) {
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll((unsigned long long)k);
+#else
+    int bit = 0;
+    while (k >>= 1)
+        ++bit;
+    return bit;
+#endif
+}
+
+/** Fill the Eytzinger layout's subtree at `k` by an in-order walk, which
+ * meets its positions in sorted order.
+ */
+void BuildEytzinger(
+        const std::vector<int> &sorted, int *keys,
+        const std::size_t padded_size, std::size_t &next,
+        const std::size_t k) {
+    if (k <= padded_size) {
+        BuildEytzinger(sorted, keys, padded_size, next, 2 * k);
+        keys[k] = next < sorted.size()
+            ? sorted[next] : std::numeric_limits<int>::max();
+        ++next;
+        BuildEytzinger(sorted, keys, padded_size, next, 2 * k + 1);
+    }
+}
+
+struct ScalarOps {
+    static int CountLess(const int *node, const int value) {
+        int count = 0;
+        for (int i = 0; i < kStaticBTreeNodeKeys; ++i)
+            count += node[i] < value;
+        return count;
+    }
+};
+
+} // namespace
+
+EytzingerIndex::EytzingerIndex(const std::vector<int> &sorted)
+        : size_(sorted.size()), height_(0), padded_size_(0) {
+    while (padded_size_ < size_) {
+        ++height_;
+        padded_size_ = 2 * padded_size_ + 1;
+    }
+    storage_.resize(padded_size_ + 1 + kLineInts - 1);
+    offset_ = CacheLineOffset(storage_);
+    std::size_t next = 0;
+    BuildEytzinger(sorted, storage_.data() + offset_, padded_size_, next, 1);
+}
+
+std::size_t EytzingerIndex::LowerBound(const int value) const {
+    const int *keys = this->keys();
+    std::size_t k = 1;
+    while (k <= padded_size_) {
+#if defined(__GNUC__)
+        // The 16 descendants of k four levels down share a cache line; a
+        // prefetch past the end of the keys is harmless
+        __builtin_prefetch(keys + 16 * k);
+#endif
+        k = 2 * k + (keys[k] < value);
+    }
+    // The path went right at every key less than the value; the last time
+    // it went left was at the lower bound
+    k = DropTrailingOnes(k);
+    if (k == 0)
+        return size_;
+    // In a perfect tree, the p-th item of depth d has (2p + 1) subtrees of
+    // its depth's children before it in order
+    int depth = HighestBit(k);
+    std::size_t position = k - ((std::size_t)1 << depth);
+    std::size_t index =
+        ((2 * position + 1) << (height_ - 1 - depth)) - 1;
+    return std::min(index, size_);
+}
+
+StaticBPlusTreeIndex::StaticBPlusTreeIndex(const std::vector<int> &sorted)
+        : size_(sorted.size()) {
+    const std::size_t node_keys = kStaticBTreeNodeKeys;
+    const int max_int = std::numeric_limits<int>::max();
+    std::size_t num_leaves = (size_ + node_keys - 1) / node_keys;
+    if (num_leaves == 0)
+        return;
+
+    // Each layer has a node per 17 nodes of the one below, up to one root
+    std::vector<std::size_t> layer_sizes(1, num_leaves);
+    while (layer_sizes.back() > 1)
+        layer_sizes.push_back(
+            (layer_sizes.back() + node_keys) / (node_keys + 1));
+    std::size_t num_nodes = 0;
+    for (std::size_t layer_size : layer_sizes) {
+        layer_offsets_.push_back(num_nodes);
+        num_nodes += layer_size;
+    }
+    storage_.resize(num_nodes * node_keys + kLineInts - 1);
+    offset_ = CacheLineOffset(storage_);
+    int *keys = storage_.data() + offset_;
+
+    std::copy(sorted.begin(), sorted.end(), keys);
+    std::fill(keys + size_, keys + num_leaves * node_keys, max_int);
+    std::size_t leaves_per_child = 1;
+    for (std::size_t h = 1; h < layer_sizes.size(); ++h) {
+        int *layer = keys + layer_offsets_[h] * node_keys;
+        for (std::size_t i = 0; i < layer_sizes[h] * node_keys; ++i) {
+            // Key j of node k is the first leaf key under child j + 1
+            std::size_t node = i / node_keys;
+            std::size_t child = node * (node_keys + 1) + i % node_keys + 1;
+            std::size_t leaf = child * leaves_per_child;
+            layer[i] = leaf * node_keys < size_
+                ? sorted[leaf * node_keys] : max_int;
+        }
+        leaves_per_child *= node_keys + 1;
+    }
+}
+
+std::size_t StaticBPlusTreeIndex::LowerBound(const int value) const {
+    if (size_ == 0)
+        return 0;
+    const int height = (int)layer_offsets_.size();
+    std::size_t position;
+    switch (ActiveSimdLevel()) {
+    case SimdLevel::kAvx512:
+        position = detail::StaticBPlusTreeSearchAvx512(
+            keys(), layer_offsets_.data(), height, value);
+        break;
+    case SimdLevel::kAvx2:
+        position = detail::StaticBPlusTreeSearchAvx2(
+            keys(), layer_offsets_.data(), height, value);
+        break;
+    default:
+        position = detail::StaticBPlusTreeSearchScalar(
+            keys(), layer_offsets_.data(), height, value);
+        break;
+    }
+    // Past the last item, the leaves are padded with the largest int
+    return std::min(position, size_);
+}
+
+namespace detail {
+
+std::size_t StaticBPlusTreeSearchScalar(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value) {
+    return StaticBPlusTreeSearch<ScalarOps>(
+        keys, layer_offsets, height, value);
+}
+
+} // namespace detail
@@ -0,0 +1,51 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt)
+
+#include "static_bplus_tree.hpp"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+
+namespace {
+
+/** Counts a node's keys less than the value in two registers of 8 ints.
+ */
+struct Avx2Ops {
+    static int CountLess(const int *node, const int value) {
+        __m256i values = _mm256_set1_epi32(value);
+        __m256i low = _mm256_load_si256((const __m256i *)node);
+        __m256i high = _mm256_load_si256((const __m256i *)(node + 8));
+        int low_mask = _mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(values, low)));
+        int high_mask = _mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(values, high)));
+        return __builtin_popcount(low_mask | high_mask << 8);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+std::size_t StaticBPlusTreeSearchAvx2(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value) {
+    return StaticBPlusTreeSearch<Avx2Ops>(keys, layer_offsets, height, value);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+std::size_t StaticBPlusTreeSearchAvx2(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value) {
+    return StaticBPlusTreeSearchScalar(keys, layer_offsets, height, value);
+}
+
+} // namespace detail
+
+#endif
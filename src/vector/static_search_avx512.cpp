@@ -0,0 +1,47 @@
+// Compiled with AVX-512 Foundation enabled (see CMakeLists.txt)
+
+#include "static_bplus_tree.hpp"
+
+#ifdef __AVX512F__
+
+#include <immintrin.h>
+
+
+namespace {
+
+/** Counts a node's keys less than the value in one register of 16 ints.
+ */
+struct Avx512Ops {
+    static int CountLess(const int *node, const int value) {
+        __mmask16 less = _mm512_cmplt_epi32_mask(
+            _mm512_load_si512((const void *)node), _mm512_set1_epi32(value));
+        return __builtin_popcount(less);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+std::size_t StaticBPlusTreeSearchAvx512(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value) {
+    return StaticBPlusTreeSearch<Avx512Ops>(
+        keys, layer_offsets, height, value);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+std::size_t StaticBPlusTreeSearchAvx512(
+        const int *keys, const std::size_t *layer_offsets, const int height,
+        const int value) {
+    return StaticBPlusTreeSearchScalar(keys, layer_offsets, height, value);
+}
+
+} // namespace detail
+
+#endif
@@ -0,0 +1,71 @@
+/** Benchmarks for `static_search.hpp`
+ *
+ * As in the binary search benchmarks, each iteration looks up as many
+ * random values as there are keys, so the time per item is the time per
+ * lookup. The largest sizes need `--benchmark_max_size=1000000000` and
+ * about 16 GB of memory for a billion keys.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/vector/binary_search.hpp"
+#include "algorithm/vector/static_search.hpp"
+
+
+namespace {
+
+/** Build an index of sorted random keys, and time lookups of random values.
+ */
+template <typename Index>
+void RunIndexBenchmark(BenchmarkState &state) {
+    auto values = GenerateBenchmarkInput(
+        state.size(), InputDistribution::kRandom);
+    std::vector<int> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+    Index index(sorted);
+    std::vector<int>().swap(sorted);
+    // Summing the results keeps the lookups from being optimized away
+    std::size_t sum = 0;
+    while (state.KeepRunning())
+        for (int value : values)
+            sum += index.LowerBound(value);
+    volatile std::size_t result = sum;
+    (void)result;
+}
+
+/** `LowerBound` of `binary_search.hpp`, in the same harness. */
+class BinarySearchIndex {
+public:
+    explicit BinarySearchIndex(const std::vector<int> &sorted)
+        : sorted_(sorted) {}
+    std::size_t LowerBound(const int value) const {
+        return ::LowerBound(sorted_.begin(), sorted_.end(), value) -
+               sorted_.begin();
+    }
+private:
+    std::vector<int> sorted_;
+};
+
+void BM_BinarySearchIndex(BenchmarkState &state) {
+    RunIndexBenchmark<BinarySearchIndex>(state);
+}
+
+void BM_EytzingerIndex(BenchmarkState &state) {
+    RunIndexBenchmark<EytzingerIndex>(state);
+}
+
+void BM_StaticBPlusTreeIndex(BenchmarkState &state) {
+    RunIndexBenchmark<StaticBPlusTreeIndex>(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_BinarySearchIndex)
+    ->Distributions({InputDistribution::kRandom})->MinSize(1000);
+BENCHMARK(BM_EytzingerIndex)
+    ->Distributions({InputDistribution::kRandom})->MinSize(1000);
+BENCHMARK(BM_StaticBPlusTreeIndex)
+    ->Distributions({InputDistribution::kRandom})->MinSize(1000);
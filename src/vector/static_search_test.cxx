@@ -0,0 +1,87 @@
+/** Unit tests for `static_search.hpp`
+ */
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/simd.hpp"
+#include "algorithm/vector/static_search.hpp"
+
+
+namespace {
+
+/** Check both indexes against `std::lower_bound` for every value in and
+ * around the vector's range.
+ */
+void ExpectLowerBounds(const std::vector<int> &sorted, const int min_value,
+                       const int max_value) {
+    EytzingerIndex eytzinger(sorted);
+    StaticBPlusTreeIndex btree(sorted);
+    ASSERT_EQ(eytzinger.size(), sorted.size());
+    ASSERT_EQ(btree.size(), sorted.size());
+    for (int value = min_value; value <= max_value; ++value) {
+        std::size_t expected = std::lower_bound(
+            sorted.begin(), sorted.end(), value) - sorted.begin();
+        ASSERT_EQ(eytzinger.LowerBound(value), expected)
+            << "Eytzinger lower bound of " << value << " is wrong for size "
+            << sorted.size();
+        ASSERT_EQ(btree.LowerBound(value), expected)
+            << "B-tree lower bound of " << value << " is wrong for size "
+            << sorted.size();
+    }
+}
+
+} // namespace
+
+TEST(StaticSearchTest, LowerBoundsMatchStandardLibrary) {
+    // Empty, within one node, exactly full levels, and partial last nodes
+    for (int size : {0, 1, 2, 15, 16, 17, 31, 272, 273, 1000, 5000}) {
+        std::vector<int> sorted(size);
+        RandomlyFillVector(sorted, -3 * size, 3 * size);
+        std::sort(sorted.begin(), sorted.end());
+        ExpectLowerBounds(sorted, -3 * size - 2, 3 * size + 2);
+    }
+}
+
+TEST(StaticSearchTest, HandlesDuplicatesAndExtremeValues) {
+    std::vector<int> sorted(3000);
+    RandomlyFillVector(sorted, 0, 20);
+    sorted.push_back(std::numeric_limits<int>::max());
+    sorted.push_back(std::numeric_limits<int>::max());
+    std::sort(sorted.begin(), sorted.end());
+    ExpectLowerBounds(sorted, -2, 22);
+
+    EytzingerIndex eytzinger(sorted);
+    StaticBPlusTreeIndex btree(sorted);
+    const int max_int = std::numeric_limits<int>::max();
+    EXPECT_EQ(eytzinger.LowerBound(max_int), sorted.size() - 2);
+    EXPECT_EQ(btree.LowerBound(max_int), sorted.size() - 2)
+        << "Padding was found before the largest keys!";
+}
+
+/** Each SIMD level's node search must agree with the others. */
+TEST(StaticSearchTest, EverySimdLevelAgrees) {
+    std::vector<int> sorted(10000);
+    RandomlyFillVector(sorted, -100000, 100000);
+    std::sort(sorted.begin(), sorted.end());
+    StaticBPlusTreeIndex btree(sorted);
+    std::vector<int> values(1000);
+    RandomlyFillVector(values, -100010, 100010);
+
+    SimdLevel detected = DetectSimdLevel();
+    for (SimdLevel level : {SimdLevel::kScalar, SimdLevel::kAvx2,
+                            SimdLevel::kAvx512}) {
+        SetSimdLevel(level);
+        for (int value : values)
+            ASSERT_EQ(btree.LowerBound(value),
+                      (std::size_t)(std::lower_bound(sorted.begin(),
+                                                     sorted.end(), value) -
+                                    sorted.begin()))
+                << "Wrong lower bound with " << SimdLevelName(level);
+    }
+    SetSimdLevel(detected);
+}
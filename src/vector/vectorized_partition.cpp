@@ -0,0 +1,39 @@
+#include "algorithm/vector/vectorized_partition.hpp"
+
+#include "algorithm/simd.hpp"
+#include "algorithm/vector/generic_sort.hpp"
+#include "compress_partition.hpp"
+
+
+namespace detail {
+
+int *VectorizedPartitionScalar(
+        int *first, int *last, const int pivot, const bool equality_check) {
+    int pivot_item = pivot;
+    Less comp;
+    Identity proj;
+    return BlockSplit(first, last, &pivot_item, comp, proj, equality_check);
+}
+
+} // namespace detail
+
+int *VectorizedPartition(
+        int *first, int *last, const int pivot, const bool equality_check) {
+    // Each level falls through to the next one down on ranges too short for it
+    switch (ActiveSimdLevel()) {
+    case SimdLevel::kAvx512:
+        if (last - first >= 2 * detail::kAvx512Lanes)
+            return detail::VectorizedPartitionAvx512(
+                first, last, pivot, equality_check);
+        // fall through
+    case SimdLevel::kAvx2:
+        if (last - first >= 2 * detail::kAvx2Lanes)
+            return detail::VectorizedPartitionAvx2(
+                first, last, pivot, equality_check);
+        break;
+    default:
+        break;
+    }
+    return detail::VectorizedPartitionScalar(
+        first, last, pivot, equality_check);
+}
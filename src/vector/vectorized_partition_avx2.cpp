@@ -0,0 +1,89 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt)
+
+#include "compress_partition.hpp"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+
+namespace {
+
+/** For each 8-bit mask of the lanes going left, the lane order that packs
+ * those lanes at the bottom of the register and the others at the top.
+ */
+struct PackingPermutations {
+    int lanes[256][detail::kAvx2Lanes];
+
+    PackingPermutations() {
+        for (int mask = 0; mask < 256; ++mask) {
+            int next = 0;
+            for (int lane = 0; lane < detail::kAvx2Lanes; ++lane)
+                if (mask & (1 << lane))
+                    lanes[mask][next++] = lane;
+            for (int lane = 0; lane < detail::kAvx2Lanes; ++lane)
+                if (!(mask & (1 << lane)))
+                    lanes[mask][next++] = lane;
+        }
+    }
+};
+
+const PackingPermutations packing_permutations;
+
+/** Partition operations on AVX2 registers of 8 ints.
+ */
+struct Avx2Ops {
+    typedef __m256i Register;
+    static const int kLanes = detail::kAvx2Lanes;
+
+    static Register Load(const int *data) {
+        return _mm256_loadu_si256((const __m256i *)data);
+    }
+    static Register Broadcast(const int value) {
+        return _mm256_set1_epi32(value);
+    }
+
+    /** AVX2 has no compress instruction, so the items are permuted into
+     * packed order, and the whole register is stored at both ends; each end
+     * only keeps its own part.
+     */
+    static int StoreSplit(
+            const Register items, const Register pivots,
+            const bool equality_check, int *left, int *right) {
+        int left_mask = equality_check ?
+            ~_mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_cmpgt_epi32(items, pivots))) & 0xff :
+            _mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_cmpgt_epi32(pivots, items)));
+        Register order = _mm256_loadu_si256(
+            (const __m256i *)packing_permutations.lanes[left_mask]);
+        Register packed = _mm256_permutevar8x32_epi32(items, order);
+        _mm256_storeu_si256((__m256i *)left, packed);
+        _mm256_storeu_si256((__m256i *)(right - kLanes), packed);
+        return __builtin_popcount(left_mask);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+int *VectorizedPartitionAvx2(
+        int *first, int *last, const int pivot, const bool equality_check) {
+    return CompressPartition<Avx2Ops>(first, last, pivot, equality_check);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+int *VectorizedPartitionAvx2(
+        int *first, int *last, const int pivot, const bool equality_check) {
+    return VectorizedPartitionScalar(first, last, pivot, equality_check);
+}
+
+} // namespace detail
+
+#endif
@@ -0,0 +1,69 @@
+// Compiled with AVX-512 Foundation enabled (see CMakeLists.txt)
+
+#include "compress_partition.hpp"
+
+#ifdef __AVX512F__
+
+#include <immintrin.h>
+
+
+namespace {
+
+/** Partition operations on AVX-512 registers of 16 ints.
+ */
+struct Avx512Ops {
+    typedef __m512i Register;
+    static const int kLanes = detail::kAvx512Lanes;
+
+    static Register Load(const int *data) {
+        return _mm512_loadu_si512((const void *)data);
+    }
+    static Register Broadcast(const int value) {
+        return _mm512_set1_epi32(value);
+    }
+
+    /** Each side's items are compressed into the bottom of a register; the
+     * left ones are stored whole, the right ones with a masked store ending
+     * at `right`. (Compressing in a register and storing is faster than
+     * compress-storing to memory on some CPUs.)
+     */
+    static int StoreSplit(
+            const Register items, const Register pivots,
+            const bool equality_check, int *left, int *right) {
+        __mmask16 left_mask = equality_check ?
+            _mm512_cmple_epi32_mask(items, pivots) :
+            _mm512_cmplt_epi32_mask(items, pivots);
+        int num_left = __builtin_popcount(left_mask);
+        int num_right = kLanes - num_left;
+        _mm512_storeu_si512(
+            (void *)left, _mm512_maskz_compress_epi32(left_mask, items));
+        _mm512_mask_storeu_epi32(
+            (void *)(right - num_right), (__mmask16)((1 << num_right) - 1),
+            _mm512_maskz_compress_epi32((__mmask16)~left_mask, items));
+        return num_left;
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+int *VectorizedPartitionAvx512(
+        int *first, int *last, const int pivot, const bool equality_check) {
+    return CompressPartition<Avx512Ops>(first, last, pivot, equality_check);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+int *VectorizedPartitionAvx512(
+        int *first, int *last, const int pivot, const bool equality_check) {
+    return VectorizedPartitionScalar(first, last, pivot, equality_check);
+}
+
+} // namespace detail
+
+#endif
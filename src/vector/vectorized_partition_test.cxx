@@ -0,0 +1,131 @@
+/** Unit tests for `vectorized_partition.cpp`
+ */
+
+#include <algorithm>
+#include <climits>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/simd.hpp"
+#include "algorithm/vector/sort.hpp"
+#include "algorithm/vector/vectorized_partition.hpp"
+
+
+/** Runs each test once per SIMD level the CPU supports.
+ */
+class VectorizedPartitionTest: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        SetSimdLevel(DetectSimdLevel());
+    }
+
+    /** Return the levels to test, from scalar up to the detected one. */
+    std::vector<SimdLevel> SupportedLevels() {
+        std::vector<SimdLevel> levels;
+        for (int level = 0; level <= (int)DetectSimdLevel(); ++level)
+            levels.push_back((SimdLevel)level);
+        return levels;
+    }
+
+    /** Check `vec` is a partition of `original` around `pivot` at `split`. */
+    void ExpectPartitioned(
+            const std::vector<int> &original, std::vector<int> vec,
+            const int split, const int pivot, const bool equality_check,
+            const std::string &error_msg) {
+        for (int i = 0; i < split; ++i)
+            ASSERT_TRUE(equality_check ? vec[i] <= pivot : vec[i] < pivot)
+                << error_msg << " Item " << i << " belongs on the right.";
+        for (int i = split; i < (int)vec.size(); ++i)
+            ASSERT_TRUE(equality_check ? vec[i] > pivot : vec[i] >= pivot)
+                << error_msg << " Item " << i << " belongs on the left.";
+
+        std::vector<int> expected_vec(original);
+        std::sort(expected_vec.begin(), expected_vec.end());
+        std::sort(vec.begin(), vec.end());
+        EXPECT_EQ(vec, expected_vec) << error_msg << " Items were lost.";
+    }
+};
+
+TEST_F(VectorizedPartitionTest, PartitionsEverySize) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        // Every remainder modulo the register sizes, and a long range
+        std::vector<int> sizes;
+        for (int size = 0; size <= 70; ++size)
+            sizes.push_back(size);
+        sizes.push_back(1000 + RandomInteger(0, 100));
+
+        for (int size : sizes) {
+            for (bool equality_check : {true, false}) {
+                std::string error_msg = std::string("The ") +
+                    SimdLevelName(level) + " partition of " +
+                    std::to_string(size) + " ints failed!";
+                std::vector<int> vec(size);
+                RandomlyFillVector(vec, -20, 20);
+                int pivot = RandomInteger(-20, 20);
+                std::vector<int> original(vec);
+
+                int *split = VectorizedPartition(
+                    vec.data(), vec.data() + size, pivot, equality_check);
+                ExpectPartitioned(
+                    original, vec, (int)(split - vec.data()), pivot,
+                    equality_check, error_msg);
+            }
+        }
+    }
+}
+
+TEST_F(VectorizedPartitionTest, PartitionsExtremeValues) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        std::vector<int> vec(100);
+        for (int i = 0; i < (int)vec.size(); ++i)
+            vec[i] = i % 3 == 0 ? INT_MAX : i % 3 == 1 ? INT_MIN : 0;
+        std::vector<int> original(vec);
+
+        for (int pivot : {INT_MIN, 0, INT_MAX}) {
+            for (bool equality_check : {true, false}) {
+                vec = original;
+                int *split = VectorizedPartition(
+                    vec.data(), vec.data() + vec.size(), pivot,
+                    equality_check);
+                ExpectPartitioned(
+                    original, vec, (int)(split - vec.data()), pivot,
+                    equality_check,
+                    std::string("The ") + SimdLevelName(level) +
+                    " partition mishandled INT_MIN/INT_MAX!");
+            }
+        }
+    }
+}
+
+TEST_F(VectorizedPartitionTest, QuicksortPartitionContractHolds) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        std::vector<int> vec(500);
+        RandomlyFillVector(vec, -100, 100);
+        std::vector<int> original(vec);
+        int pivot = vec.back();
+
+        int p = VectorizedQuicksortPartition(vec, 0, (int)vec.size());
+        EXPECT_EQ(vec[p], pivot) << "Pivot was not put in place!";
+        // The pivot itself counts as part of the left partition
+        ExpectPartitioned(
+            original, vec, p + 1, pivot, true,
+            std::string("The ") + SimdLevelName(level) +
+            " quicksort partition failed!");
+    }
+}
+
+TEST(VectorizedQuicksortPartitionTest, FallsBackForOtherTypes) {
+    std::vector<double> vec = {2.5, -1.0, 7.25, 0.5, 3.0, -4.5, 1.5};
+    auto p = VectorizedQuicksortPartition(vec.begin(), vec.end());
+    EXPECT_EQ(*p, 1.5) << "Pivot was not put in place!";
+    for (auto item = vec.begin(); item != p; ++item)
+        EXPECT_LE(*item, 1.5) << "Item belongs right of the pivot!";
+    for (auto item = p + 1; item != vec.end(); ++item)
+        EXPECT_GT(*item, 1.5) << "Item belongs left of the pivot!";
+}
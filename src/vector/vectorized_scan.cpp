@@ -0,0 +1,178 @@
+#include "algorithm/vector/vectorized_scan.hpp"
+
+#include <climits>
+
+#include "algorithm/simd.hpp"
+#include "scan_kernels.hpp"
+
+
+namespace {
+
+/** Longest range a kernel scans at once: its lanes hold indices as ints. */
+const long kMaxScanChunk = 1L << 30;
+
+/** Return the first smallest (or, if `max`, largest) int, a chunk of at most
+ * `kMaxScanChunk` ints at a time.
+ */
+template <bool max>
+const int *ExtremeElement(const int *first, const int *last) {
+    const int *extreme = last;
+    while (first != last) {
+        const int *chunk_last =
+            last - first > kMaxScanChunk ? first + kMaxScanChunk : last;
+        const int *chunk_extreme;
+        switch (ActiveSimdLevel()) {
+        case SimdLevel::kAvx512:
+            chunk_extreme = max
+                ? detail::MaxElementAvx512(first, chunk_last)
+                : detail::MinElementAvx512(first, chunk_last);
+            break;
+        case SimdLevel::kAvx2:
+            chunk_extreme = max
+                ? detail::MaxElementAvx2(first, chunk_last)
+                : detail::MinElementAvx2(first, chunk_last);
+            break;
+        default:
+            chunk_extreme = max
+                ? detail::MaxElementScalar(first, chunk_last)
+                : detail::MinElementScalar(first, chunk_last);
+            break;
+        }
+        if (extreme == last ||
+                (max ? *extreme < *chunk_extreme : *chunk_extreme < *extreme))
+            extreme = chunk_extreme;
+        first = chunk_last;
+    }
+    return extreme;
+}
+
+/** Return the statistics of at most `kMaxScanChunk` ints. */
+ScanStatistics ChunkStatistics(const int *first, const int *last) {
+    switch (ActiveSimdLevel()) {
+    case SimdLevel::kAvx512:
+        return detail::StatisticsAvx512(first, last);
+    case SimdLevel::kAvx2:
+        return detail::StatisticsAvx2(first, last);
+    default:
+        return detail::StatisticsScalar(first, last);
+    }
+}
+
+} // namespace
+
+namespace detail {
+
+const int *FindScalar(const int *first, const int *last, const int value) {
+    for (; first != last; ++first)
+        if (*first == value)
+            return first;
+    return last;
+}
+
+const int *MinElementScalar(const int *first, const int *last) {
+    if (first == last)
+        return last;
+    const int *extreme = first;
+    for (++first; first != last; ++first)
+        if (*first < *extreme)
+            extreme = first;
+    return extreme;
+}
+
+const int *MaxElementScalar(const int *first, const int *last) {
+    if (first == last)
+        return last;
+    const int *extreme = first;
+    for (++first; first != last; ++first)
+        if (*extreme < *first)
+            extreme = first;
+    return extreme;
+}
+
+ScanStatistics StatisticsScalar(const int *first, const int *last) {
+    ScanStatistics statistics = {INT_MAX, INT_MIN, 0, 0, 0, 0};
+    statistics.count = last - first;
+    if (first == last)
+        return statistics;
+    statistics.min = statistics.max = *first;
+    statistics.sum = *first;
+
+    // Of each pair, only the smaller can be a new minimum and only the larger
+    // a new maximum. Ordering the pair with conditional moves rather than a
+    // branch leaves only the rarely taken branches on new extremes
+    const int *item = first + 1;
+    for (; last - item >= 2; item += 2) {
+        int a = item[0];
+        int b = item[1];
+        statistics.sum += (long long)a + b;
+        bool swap = b < a;
+        int smaller = swap ? b : a;
+        int larger = swap ? a : b;
+        if (smaller < statistics.min) {
+            statistics.min = smaller;
+            statistics.min_index = item + swap - first;
+        }
+        if (statistics.max < larger) {
+            statistics.max = larger;
+            // The first of the pair, if they are equal
+            statistics.max_index = item + (a < b) - first;
+        }
+    }
+    if (item != last) {
+        statistics.sum += *item;
+        if (*item < statistics.min) {
+            statistics.min = *item;
+            statistics.min_index = item - first;
+        }
+        else if (statistics.max < *item) {
+            statistics.max = *item;
+            statistics.max_index = item - first;
+        }
+    }
+    return statistics;
+}
+
+} // namespace detail
+
+const int *VectorizedFind(
+        const int *first, const int *last, const int value) {
+    switch (ActiveSimdLevel()) {
+    case SimdLevel::kAvx512:
+        return detail::FindAvx512(first, last, value);
+    case SimdLevel::kAvx2:
+        return detail::FindAvx2(first, last, value);
+    default:
+        return detail::FindScalar(first, last, value);
+    }
+}
+
+const int *VectorizedMinElement(const int *first, const int *last) {
+    return ExtremeElement<false>(first, last);
+}
+
+const int *VectorizedMaxElement(const int *first, const int *last) {
+    return ExtremeElement<true>(first, last);
+}
+
+ScanStatistics VectorizedStatistics(const int *first, const int *last) {
+    ScanStatistics statistics = detail::StatisticsScalar(first, first);
+    // A chunk at a time, as in `ExtremeElement`
+    for (const int *chunk = first; chunk != last; ) {
+        const int *chunk_last =
+            last - chunk > kMaxScanChunk ? chunk + kMaxScanChunk : last;
+        ScanStatistics chunk_statistics = ChunkStatistics(chunk, chunk_last);
+        std::size_t offset = chunk - first;
+        if (chunk_statistics.min < statistics.min || chunk == first) {
+            statistics.min = chunk_statistics.min;
+            statistics.min_index = offset + chunk_statistics.min_index;
+        }
+        if (statistics.max < chunk_statistics.max || chunk == first) {
+            statistics.max = chunk_statistics.max;
+            statistics.max_index = offset + chunk_statistics.max_index;
+        }
+        statistics.sum += chunk_statistics.sum;
+        statistics.count += chunk_statistics.count;
+        chunk = chunk_last;
+    }
+    return statistics;
+}
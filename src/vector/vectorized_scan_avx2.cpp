@@ -0,0 +1,109 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt)
+
+#include "scan_kernels.hpp"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+
+namespace {
+
+/** Scan operations on AVX2 registers of 8 ints.
+ */
+struct Avx2Ops {
+    typedef __m256i Register;
+    typedef __m256i Mask;
+    static const int kLanes = 8;
+
+    static Register Load(const int *data) {
+        return _mm256_loadu_si256((const __m256i *)data);
+    }
+
+    static void Store(int *data, const Register items) {
+        _mm256_storeu_si256((__m256i *)data, items);
+    }
+
+    static Register Broadcast(const int value) {
+        return _mm256_set1_epi32(value);
+    }
+
+    static Register LaneIndices() {
+        return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    }
+
+    static Register Add(const Register a, const Register b) {
+        return _mm256_add_epi32(a, b);
+    }
+
+    static Mask Less(const Register a, const Register b) {
+        return _mm256_cmpgt_epi32(b, a);
+    }
+
+    static Register Select(
+            const Mask mask, const Register a, const Register b) {
+        return _mm256_blendv_epi8(b, a, mask);
+    }
+
+    static unsigned int EqualBits(const Register a, const Register b) {
+        return (unsigned int)_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+    }
+
+    static Register AddWide(const Register sums, const Register items) {
+        __m256i low = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(items));
+        __m256i high = _mm256_cvtepi32_epi64(
+            _mm256_extracti128_si256(items, 1));
+        return _mm256_add_epi64(sums, _mm256_add_epi64(low, high));
+    }
+
+    static void StoreWide(long long *data, const Register sums) {
+        _mm256_storeu_si256((__m256i *)data, sums);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+const int *FindAvx2(const int *first, const int *last, const int value) {
+    return ScanFind<Avx2Ops>(first, last, value);
+}
+
+const int *MinElementAvx2(const int *first, const int *last) {
+    return ScanExtreme<Avx2Ops, false>(first, last);
+}
+
+const int *MaxElementAvx2(const int *first, const int *last) {
+    return ScanExtreme<Avx2Ops, true>(first, last);
+}
+
+ScanStatistics StatisticsAvx2(const int *first, const int *last) {
+    return ScanSummary<Avx2Ops>(first, last);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const int *FindAvx2(const int *first, const int *last, const int value) {
+    return FindScalar(first, last, value);
+}
+
+const int *MinElementAvx2(const int *first, const int *last) {
+    return MinElementScalar(first, last);
+}
+
+const int *MaxElementAvx2(const int *first, const int *last) {
+    return MaxElementScalar(first, last);
+}
+
+ScanStatistics StatisticsAvx2(const int *first, const int *last) {
+    return StatisticsScalar(first, last);
+}
+
+} // namespace detail
+
+#endif
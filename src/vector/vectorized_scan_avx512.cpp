@@ -0,0 +1,109 @@
+// Compiled with AVX-512 Foundation enabled (see CMakeLists.txt)
+
+#include "scan_kernels.hpp"
+
+#ifdef __AVX512F__
+
+#include <immintrin.h>
+
+
+namespace {
+
+/** Scan operations on AVX-512 registers of 16 ints.
+ */
+struct Avx512Ops {
+    typedef __m512i Register;
+    typedef __mmask16 Mask;
+    static const int kLanes = 16;
+
+    static Register Load(const int *data) {
+        return _mm512_loadu_si512((const void *)data);
+    }
+
+    static void Store(int *data, const Register items) {
+        _mm512_storeu_si512((void *)data, items);
+    }
+
+    static Register Broadcast(const int value) {
+        return _mm512_set1_epi32(value);
+    }
+
+    static Register LaneIndices() {
+        return _mm512_setr_epi32(
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    }
+
+    static Register Add(const Register a, const Register b) {
+        return _mm512_add_epi32(a, b);
+    }
+
+    static Mask Less(const Register a, const Register b) {
+        return _mm512_cmplt_epi32_mask(a, b);
+    }
+
+    static Register Select(
+            const Mask mask, const Register a, const Register b) {
+        return _mm512_mask_blend_epi32(mask, b, a);
+    }
+
+    static unsigned int EqualBits(const Register a, const Register b) {
+        return _mm512_cmpeq_epi32_mask(a, b);
+    }
+
+    static Register AddWide(const Register sums, const Register items) {
+        __m512i low = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(items));
+        __m512i high = _mm512_cvtepi32_epi64(
+            _mm512_extracti64x4_epi64(items, 1));
+        return _mm512_add_epi64(sums, _mm512_add_epi64(low, high));
+    }
+
+    static void StoreWide(long long *data, const Register sums) {
+        _mm512_storeu_si512((void *)data, sums);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+const int *FindAvx512(const int *first, const int *last, const int value) {
+    return ScanFind<Avx512Ops>(first, last, value);
+}
+
+const int *MinElementAvx512(const int *first, const int *last) {
+    return ScanExtreme<Avx512Ops, false>(first, last);
+}
+
+const int *MaxElementAvx512(const int *first, const int *last) {
+    return ScanExtreme<Avx512Ops, true>(first, last);
+}
+
+ScanStatistics StatisticsAvx512(const int *first, const int *last) {
+    return ScanSummary<Avx512Ops>(first, last);
+}
+
+} // namespace detail
+
+#else
+
+namespace detail {
+
+const int *FindAvx512(const int *first, const int *last, const int value) {
+    return FindScalar(first, last, value);
+}
+
+const int *MinElementAvx512(const int *first, const int *last) {
+    return MinElementScalar(first, last);
+}
+
+const int *MaxElementAvx512(const int *first, const int *last) {
+    return MaxElementScalar(first, last);
+}
+
+ScanStatistics StatisticsAvx512(const int *first, const int *last) {
+    return StatisticsScalar(first, last);
+}
+
+} // namespace detail
+
+#endif
@@ -0,0 +1,115 @@
+/** Benchmarks for `vectorized_scan.cpp`
+ *
+ * The searches look for a value that is not there, so every one scans the
+ * whole input. Each scan runs at the scalar level and at the best one the
+ * CPU has, next to its standard library counterpart.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "benchmark/benchmark.hpp"
+
+#include "algorithm/simd.hpp"
+#include "algorithm/vector/vectorized_scan.hpp"
+
+
+namespace {
+
+/** Time a scan of the input at a SIMD level (or skip, if unsupported).
+ */
+template <typename ScanFunction>
+void RunScanBenchmark(
+        BenchmarkState &state, const SimdLevel level, ScanFunction scan) {
+    if (SetSimdLevel(level) != level) {
+        state.SkipWithMessage("SIMD level not supported by this CPU");
+        SetSimdLevel(DetectSimdLevel());
+        return;
+    }
+    auto input = GenerateBenchmarkInput(state.size(), state.distribution());
+    // No generated item is this small, so the search never stops early
+    std::replace(input.begin(), input.end(), INT_MIN, INT_MIN + 1);
+    const int *first = input.data();
+    const int *last = first + input.size();
+    // Summing the results keeps the scans from being optimized away
+    std::size_t sum = 0;
+    while (state.KeepRunning())
+        sum += scan(first, last) - first;
+    volatile std::size_t result = sum;
+    (void)result;
+    SetSimdLevel(DetectSimdLevel());
+}
+
+const int *Find(const int *first, const int *last) {
+    return VectorizedFind(first, last, INT_MIN);
+}
+
+const int *StdFind(const int *first, const int *last) {
+    return std::find(first, last, INT_MIN);
+}
+
+const int *StdMinElement(const int *first, const int *last) {
+    return std::min_element(first, last);
+}
+
+const int *StdMinMaxElement(const int *first, const int *last) {
+    return std::minmax_element(first, last).second;
+}
+
+const int *Statistics(const int *first, const int *last) {
+    return first + VectorizedStatistics(first, last).max_index;
+}
+
+void BM_StdFind(BenchmarkState &state) {
+    RunScanBenchmark(state, SimdLevel::kScalar, StdFind);
+}
+
+void BM_VectorizedFindScalar(BenchmarkState &state) {
+    RunScanBenchmark(state, SimdLevel::kScalar, Find);
+}
+
+void BM_VectorizedFind(BenchmarkState &state) {
+    RunScanBenchmark(state, DetectSimdLevel(), Find);
+}
+
+void BM_StdMinElement(BenchmarkState &state) {
+    RunScanBenchmark(state, SimdLevel::kScalar, StdMinElement);
+}
+
+void BM_VectorizedMinElementScalar(BenchmarkState &state) {
+    RunScanBenchmark(state, SimdLevel::kScalar, VectorizedMinElement);
+}
+
+void BM_VectorizedMinElement(BenchmarkState &state) {
+    RunScanBenchmark(state, DetectSimdLevel(), VectorizedMinElement);
+}
+
+void BM_StdMinMaxElement(BenchmarkState &state) {
+    RunScanBenchmark(state, SimdLevel::kScalar, StdMinMaxElement);
+}
+
+void BM_VectorizedStatisticsScalar(BenchmarkState &state) {
+    RunScanBenchmark(state, SimdLevel::kScalar, Statistics);
+}
+
+void BM_VectorizedStatistics(BenchmarkState &state) {
+    RunScanBenchmark(state, DetectSimdLevel(), Statistics);
+}
+
+} // namespace
+
+BENCHMARK(BM_StdFind)->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_VectorizedFindScalar)
+    ->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_VectorizedFind)->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_StdMinElement)->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_VectorizedMinElementScalar)
+    ->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_VectorizedMinElement)
+    ->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_StdMinMaxElement)->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_VectorizedStatisticsScalar)
+    ->Distributions({InputDistribution::kRandom});
+BENCHMARK(BM_VectorizedStatistics)
+    ->Distributions({InputDistribution::kRandom});
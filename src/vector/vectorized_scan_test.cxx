@@ -0,0 +1,159 @@
+/** Unit tests for `vectorized_scan.cpp`
+ */
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "algorithm/random.hpp"
+#include "algorithm/simd.hpp"
+#include "algorithm/vector/vectorized_scan.hpp"
+
+
+/** Runs each test once per SIMD level the CPU supports.
+ */
+class VectorizedScanTest: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        SetSimdLevel(DetectSimdLevel());
+    }
+
+    /** Return the levels to test, from scalar up to the detected one. */
+    std::vector<SimdLevel> SupportedLevels() {
+        std::vector<SimdLevel> levels;
+        for (int level = 0; level <= (int)DetectSimdLevel(); ++level)
+            levels.push_back((SimdLevel)level);
+        return levels;
+    }
+
+    /** Every remainder modulo the unrolled register widths, and a long
+     * range.
+     */
+    std::vector<int> Sizes() {
+        std::vector<int> sizes;
+        for (int size = 0; size <= 130; ++size)
+            sizes.push_back(size);
+        sizes.push_back(1000 + RandomInteger(0, 100));
+        return sizes;
+    }
+};
+
+TEST_F(VectorizedScanTest, FindMatchesStandardLibrary) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        for (int size : Sizes()) {
+            // Few distinct values, so most are found, some more than once
+            std::vector<int> vec(size);
+            RandomlyFillVector(vec, 0, size / 4 + 1);
+            const int *first = vec.data();
+            const int *last = first + size;
+            for (int value = -1; value <= size / 4 + 2; ++value)
+                ASSERT_EQ(VectorizedFind(first, last, value),
+                          std::find(first, last, value))
+                    << "Wrong position of " << value << " at SIMD level "
+                    << SimdLevelName(level) << ", size " << size << ".";
+        }
+    }
+}
+
+TEST_F(VectorizedScanTest, FindsValueInEveryPosition) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        std::vector<int> vec(100, INT_MIN);
+        for (int i = 0; i < (int)vec.size(); ++i) {
+            vec[i] = INT_MAX;
+            ASSERT_EQ(VectorizedFind(
+                          vec.data(), vec.data() + vec.size(), INT_MAX) -
+                      vec.data(), i)
+                << "Missed the value at SIMD level " << SimdLevelName(level)
+                << ".";
+            vec[i] = INT_MIN;
+        }
+    }
+}
+
+TEST_F(VectorizedScanTest, MinAndMaxMatchStandardLibrary) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        for (int size : Sizes()) {
+            // Few distinct values, so there are ties for the first extreme
+            std::vector<int> vec(size);
+            RandomlyFillVector(vec, -3, 3);
+            const int *first = vec.data();
+            const int *last = first + size;
+            ASSERT_EQ(VectorizedMinElement(first, last),
+                      std::min_element(first, last))
+                << "Wrong minimum at SIMD level " << SimdLevelName(level)
+                << ", size " << size << ".";
+            ASSERT_EQ(VectorizedMaxElement(first, last),
+                      std::max_element(first, last))
+                << "Wrong maximum at SIMD level " << SimdLevelName(level)
+                << ", size " << size << ".";
+        }
+    }
+}
+
+TEST_F(VectorizedScanTest, MinAndMaxHandleExtremeValues) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        std::vector<int> vec(100, 0);
+        for (int i = 0; i < (int)vec.size(); ++i) {
+            vec[i] = INT_MIN;
+            vec[vec.size() - 1 - i] = INT_MAX;
+            const int *first = vec.data();
+            const int *last = first + vec.size();
+            ASSERT_EQ(VectorizedMinElement(first, last),
+                      std::min_element(first, last))
+                << "Wrong minimum at SIMD level " << SimdLevelName(level)
+                << ".";
+            ASSERT_EQ(VectorizedMaxElement(first, last),
+                      std::max_element(first, last))
+                << "Wrong maximum at SIMD level " << SimdLevelName(level)
+                << ".";
+            vec[i] = 0;
+            vec[vec.size() - 1 - i] = 0;
+        }
+    }
+}
+
+TEST_F(VectorizedScanTest, StatisticsMatchStandardLibrary) {
+    for (SimdLevel level : SupportedLevels()) {
+        SetSimdLevel(level);
+        for (int size : Sizes()) {
+            // Few distinct values for ties, and the extreme ints, whose sum
+            // overflows an int
+            std::vector<int> vec(size);
+            RandomlyFillVector(vec, -3, 3);
+            for (int &item : vec)
+                if (item == 3)
+                    item = INT_MAX;
+                else if (item == -3)
+                    item = INT_MIN;
+            const int *first = vec.data();
+            const int *last = first + size;
+            auto statistics = VectorizedStatistics(first, last);
+
+            long long sum = 0;
+            for (int item : vec)
+                sum += item;
+            EXPECT_EQ(statistics.count, (std::size_t)size);
+            EXPECT_EQ(statistics.sum, sum)
+                << "Wrong sum at SIMD level " << SimdLevelName(level)
+                << ", size " << size << ".";
+            if (size == 0)
+                continue;
+            ASSERT_EQ(first + statistics.min_index,
+                      std::min_element(first, last))
+                << "Wrong minimum at SIMD level " << SimdLevelName(level)
+                << ", size " << size << ".";
+            ASSERT_EQ(first + statistics.max_index,
+                      std::max_element(first, last))
+                << "Wrong maximum at SIMD level " << SimdLevelName(level)
+                << ", size " << size << ".";
+            EXPECT_EQ(statistics.min, vec[statistics.min_index]);
+            EXPECT_EQ(statistics.max, vec[statistics.max_index]);
+        }
+    }
+}